@@ -0,0 +1,907 @@
+﻿/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "include/WonSY_NotNull.h"
+#include "include/WonSY_Nullable.h"
+#include "include/WonSY_NotNullRef.h"
+#include "include/WonSY_NotNullPool.h"
+#include "include/WonSY_NotNullBatch.h"
+#include "include/WonSY_NullableScan.h"
+
+
+/*
+	NotNull, Nullable이 "if( !ptr ) 대비 오버헤드가 없다"는 것을 확인하기 위한 벤치마크입니다.
+
+	각 케이스는 Wsy( NotNull, Nullable ) 코드와, 같은 일을 하는 기존 포인터 코드를 짝으로 측정하며,
+	ns/op, 1회당 할당 횟수( allocs/op ), 1회당 레퍼런스 카운트 원자 연산 횟수( refOps/op )를 출력합니다.
+
+		- allocs/op : 전역 operator new를 교체하여 실제 할당 횟수를 셉니다.
+		- refOps/op : 표준 shared_ptr의 원자 연산은 외부에서 가로챌 수 없어,
+		              1회 실행 중 Probe 지점에서 원본( shared_ptr, 혹은 IntrusivePtr 등의 NotNull )의 use_count가 늘어난 만큼을 owner로 보고, owner 하나당 증가 + 감소 2회로 계산합니다.
+		              ( Probe 지점 이전에 이미 소멸된 임시 복사본은 집계되지 않으므로, 하한값으로 봐주세요. )
+		- libstdc++의 shared_ptr은 스레드가 하나뿐인 프로그램에서는 원자 연산을 생략하므로, 측정 전에 스레드를 하나 생성하여 멀티스레드 프로그램과 같은 조건으로 측정합니다.
+
+	사용법 : Benchmark [ IterationCount ]
+*/
+
+namespace WonSY::Benchmark
+{
+	// 측정은 단일 스레드로 동작하므로, 카운터를 원자적으로 처리하지 않습니다.
+	inline std::size_t g_allocCount = 0;
+}
+
+void* operator new( const std::size_t size )
+{
+	++WonSY::Benchmark::g_allocCount;
+
+	if ( void* const ptr = std::malloc( size ? size : 1 ) )
+		return ptr;
+
+	throw std::bad_alloc{};
+}
+
+void* operator new[]( const std::size_t size )
+{
+	return ::operator new( size );
+}
+
+void operator delete( void* const ptr ) noexcept
+{
+	std::free( ptr );
+}
+
+void operator delete[]( void* const ptr ) noexcept
+{
+	std::free( ptr );
+}
+
+void operator delete( void* const ptr, std::size_t ) noexcept
+{
+	std::free( ptr );
+}
+
+void operator delete[]( void* const ptr, std::size_t ) noexcept
+{
+	std::free( ptr );
+}
+
+// NotNullPool, NotNullBatch처럼 정렬을 지정하여 할당하는 경우도 집계합니다.
+void* operator new( const std::size_t size, const std::align_val_t align )
+{
+	++WonSY::Benchmark::g_allocCount;
+
+	const std::size_t alignment   = static_cast< std::size_t >( align );
+	const std::size_t alignedSize = ( ( size ? size : 1 ) + alignment - 1 ) / alignment * alignment;
+
+#ifdef _MSC_VER
+	if ( void* const ptr = _aligned_malloc( alignedSize, alignment ) )
+#else
+	if ( void* const ptr = std::aligned_alloc( alignment, alignedSize ) )
+#endif
+		return ptr;
+
+	throw std::bad_alloc{};
+}
+
+void operator delete( void* const ptr, const std::align_val_t ) noexcept
+{
+#ifdef _MSC_VER
+	_aligned_free( ptr );
+#else
+	std::free( ptr );
+#endif
+}
+
+void operator delete( void* const ptr, std::size_t, const std::align_val_t align ) noexcept
+{
+	::operator delete( ptr, align );
+}
+
+namespace WonSY::Benchmark
+{
+	using Clock       = std::chrono::steady_clock;
+	using ElementType = int;
+
+	inline constexpr std::size_t DefaultIterationCount = 1 << 22;
+
+	// 컴파일러가 측정 대상 코드를 제거하거나, 반복문 밖으로 끌어내지 못하도록 합니다.
+	template< typename T >
+	inline void DoNotOptimize( T& value )
+	{
+#if defined( _MSC_VER )
+		static const void* volatile s_sink = nullptr;
+		s_sink = std::addressof( value );
+#else
+		asm volatile( "" : "+m"( value ) : : "memory" );
+#endif
+	}
+
+	// 시간 측정 시에 사용하는 Probe로, 아무 일도 하지 않습니다.
+	class NoProbe
+	{
+	public:
+		void Sample() noexcept {}
+	};
+
+	// refOps 측정 시에 확인하는 원본의 use_count입니다. ( 원본이 없다면 nullptr을 넘기며, 0으로 집계됩니다. )
+	template< typename T >
+	long GetWatchedUseCount( const std::shared_ptr< T >* watched ) noexcept
+	{
+		return watched->use_count();
+	}
+
+	template< typename T >
+	long GetWatchedUseCount( const NotNull< T >* watched ) noexcept
+	{
+		return watched->GetUseCount();
+	}
+
+	inline long GetWatchedUseCount( std::nullptr_t ) noexcept
+	{
+		return 0;
+	}
+
+	// refOps 측정 시에 사용하는 Probe로, Sample 지점에서 원본의 owner 증가량을 기록합니다.
+	template< typename Watched >
+	class RefProbe
+	{
+	private:
+		Watched m_watched;
+		long    m_baseline;
+		long    m_peak;
+
+	public:
+		explicit RefProbe( const Watched watched ) noexcept
+			: m_watched { watched                        }
+			, m_baseline{ GetWatchedUseCount( watched ) }
+			, m_peak    { 0                              }
+		{
+		}
+
+		void Sample() noexcept
+		{
+			m_peak = std::max( m_peak, GetWatchedUseCount( m_watched ) - m_baseline );
+		}
+
+		long GetRefOps() const noexcept
+		{
+			return m_peak * 2;
+		}
+	};
+
+	struct Result
+	{
+		const char* name;
+		double      nsPerOp;
+		double      allocsPerOp;
+		long        refOpsPerOp;
+	};
+
+	template< typename Watched, typename Func >
+	Result Measure( const char* name, const std::size_t iterationCount, const Watched watched, Func&& func )
+	{
+		NoProbe noProbe;
+		for ( std::size_t i = 0; i < iterationCount / 16; ++i )
+			func( noProbe );
+
+		const auto allocBefore = g_allocCount;
+		const auto begin       = Clock::now();
+
+		for ( std::size_t i = 0; i < iterationCount; ++i )
+			func( noProbe );
+
+		const auto end        = Clock::now();
+		const auto allocAfter = g_allocCount;
+
+		RefProbe< Watched > refProbe{ watched };
+		func( refProbe );
+
+		const double elapsedNs = static_cast< double >( std::chrono::duration_cast< std::chrono::nanoseconds >( end - begin ).count() );
+
+		return Result{
+			name,
+			elapsedNs / static_cast< double >( iterationCount ),
+			static_cast< double >( allocAfter - allocBefore ) / static_cast< double >( iterationCount ),
+			refProbe.GetRefOps() };
+	}
+
+	void PrintHeader( const char* groupName )
+	{
+		std::printf( "\n[ %s ]\n", groupName );
+		std::printf( "  %-44s %10s %10s %10s\n", "case", "ns/op", "allocs/op", "refOps/op" );
+	}
+
+	void PrintPair( const Result& wsy, const Result& raw )
+	{
+		for ( const Result* result : { &wsy, &raw } )
+			std::printf( "  %-44s %10.3f %10.3f %10ld\n", result->name, result->nsPerOp, result->allocsPerOp, result->refOpsPerOp );
+
+		const double overhead = raw.nsPerOp > 0.0 ? ( wsy.nsPerOp / raw.nsPerOp - 1.0 ) * 100.0 : 0.0;
+		std::printf( "  %-44s %+9.1f%%\n", "  -> overhead", overhead );
+	}
+
+	// IntrusivePtr 비교를 위해, 레퍼런스 카운트를 개체 내부에 두는 ElementType입니다.
+	struct IntrusiveElement
+		: public IntrusiveRefCounted< IntrusiveElement >
+	{
+		ElementType value;
+
+		explicit IntrusiveElement( const ElementType inValue ) noexcept : value{ inValue } {}
+	};
+
+	// 벤치마크에서 NotNull< T* >를 얻기 위해, 매크로를 통한 정상적인 확장 경로를 사용합니다.
+	template< typename Type >
+	std::optional< NotNull< Type > > ExpandOnce( const Nullable< Type >& nullable )
+	{
+		EXPAND_TO_NOTNULL( nullable, notnull, std::nullopt );
+
+		return notnull;
+	}
+
+	void RunConstruction( const std::size_t iterationCount )
+	{
+		PrintHeader( "Construction" );
+
+		PrintPair(
+			Measure( "WsyNotNullShared::MakeNotNull", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto notnull = WsyNotNullShared< ElementType >::MakeNotNull( 7 );
+					probe.Sample();
+					DoNotOptimize( notnull );
+				} ),
+			Measure( "std::make_shared", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto ptr = std::make_shared< ElementType >( 7 );
+					probe.Sample();
+					DoNotOptimize( ptr );
+				} ) );
+
+		PrintPair(
+			Measure( "WsyNotNullUnique::MakeNotNull", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto notnull = WsyNotNullUnique< ElementType >::MakeNotNull( 7 );
+					probe.Sample();
+					DoNotOptimize( notnull );
+				} ),
+			Measure( "std::make_unique", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto ptr = std::make_unique< ElementType >( 7 );
+					probe.Sample();
+					DoNotOptimize( ptr );
+				} ) );
+
+		PrintPair(
+			Measure( "WsyNullableRaw::MakeNullable + Release", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto nullable = WsyNullableRaw< ElementType >::MakeNullable( 7 );
+					probe.Sample();
+					DoNotOptimize( nullable );
+					nullable.Release();
+				} ),
+			Measure( "new + delete", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					ElementType* ptr = new ElementType( 7 );
+					probe.Sample();
+					DoNotOptimize( ptr );
+					delete ptr;
+				} ) );
+
+		PrintPair(
+			Measure( "WsyNotNullInline::MakeNotNull", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto notnull = WsyNotNullInline< ElementType >::MakeNotNull( 7 );
+					probe.Sample();
+					DoNotOptimize( notnull );
+				} ),
+			Measure( "ElementType ( value )", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					ElementType value = 7;
+					probe.Sample();
+					DoNotOptimize( value );
+				} ) );
+
+		PrintPair(
+			Measure( "WsyNullableShared::MakeNullable", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto nullable = WsyNullableShared< ElementType >::MakeNullable( 7 );
+					probe.Sample();
+					DoNotOptimize( nullable );
+				} ),
+			Measure( "std::make_shared ( as nullable )", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					std::shared_ptr< ElementType > ptr = std::make_shared< ElementType >( 7 );
+					probe.Sample();
+					DoNotOptimize( ptr );
+				} ) );
+	}
+
+	void RunArenaConstruction( const std::size_t iterationCount )
+	{
+		PrintHeader( "Construction ( pmr::monotonic_buffer_resource )" );
+
+		// 프레임 단위 arena를 흉내내기 위해, 일정 횟수마다 arena를 한번에 해제합니다.
+		constexpr std::size_t FrameSize = 1024;
+
+		std::pmr::monotonic_buffer_resource arena;
+		std::pmr::memory_resource*          resource = &arena;
+		std::size_t                         count    = 0;
+
+		PrintPair(
+			Measure( "WsyNotNullShared::AllocateNotNull", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					{
+						auto notnull = WsyNotNullShared< ElementType >::AllocateNotNull( resource, 7 );
+						probe.Sample();
+						DoNotOptimize( notnull );
+					}
+
+					if ( ++count % FrameSize == 0 )
+						arena.release();
+				} ),
+			Measure( "std::allocate_shared", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					{
+						auto ptr = std::allocate_shared< ElementType >( std::pmr::polymorphic_allocator< ElementType >( resource ), 7 );
+						probe.Sample();
+						DoNotOptimize( ptr );
+					}
+
+					if ( ++count % FrameSize == 0 )
+						arena.release();
+				} ) );
+
+		PrintPair(
+			Measure( "WsyNullableRaw::AllocateNullable + Release", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto nullable = WsyNullableRaw< ElementType >::AllocateNullable( resource, 7 );
+					probe.Sample();
+					DoNotOptimize( nullable );
+					nullable.Release( resource );
+
+					if ( ++count % FrameSize == 0 )
+						arena.release();
+				} ),
+			Measure( "resource->allocate + deallocate", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					ElementType* ptr = static_cast< ElementType* >( resource->allocate( sizeof( ElementType ), alignof( ElementType ) ) );
+					std::construct_at( ptr, 7 );
+					probe.Sample();
+					DoNotOptimize( ptr );
+					std::destroy_at( ptr );
+					resource->deallocate( ptr, sizeof( ElementType ), alignof( ElementType ) );
+
+					if ( ++count % FrameSize == 0 )
+						arena.release();
+				} ) );
+	}
+
+	void RunPoolConstruction( const std::size_t iterationCount )
+	{
+		PrintHeader( "Construction ( NotNullPool )" );
+
+		PrintPair(
+			Measure( "WsyNotNullPool::AcquireNotNull", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto notnull = WsyNotNullPool< ElementType >::AcquireNotNull( 7 );
+					probe.Sample();
+					DoNotOptimize( notnull );
+				} ),
+			Measure( "std::make_shared", iterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto ptr = std::make_shared< ElementType >( 7 );
+					probe.Sample();
+					DoNotOptimize( ptr );
+				} ) );
+	}
+
+	// 한번에 BatchSize개를 생성하는 비용을 비교합니다. ( 1회 = BatchSize개 생성 및 소멸 )
+	void RunBatchConstruction( const std::size_t iterationCount )
+	{
+		constexpr std::size_t BatchSize = 1024;
+
+		PrintHeader( "Construction ( MakeNotNullBatch, per 1024 )" );
+
+		const std::size_t batchIterationCount = std::max< std::size_t >( iterationCount / BatchSize, 1 );
+
+		PrintPair(
+			Measure( "WonSY::MakeNotNullBatch", batchIterationCount, nullptr, [ & ]( auto& probe )
+				{
+					auto batch = WonSY::MakeNotNullBatch< ElementType >( BatchSize, 7 );
+					probe.Sample();
+					DoNotOptimize( batch );
+				} ),
+			Measure( "std::make_shared x 1024", batchIterationCount, nullptr, [ & ]( auto& probe )
+				{
+					std::shared_ptr< ElementType > ptrs[ BatchSize ];
+					for ( auto& ptr : ptrs )
+						ptr = std::make_shared< ElementType >( 7 );
+
+					probe.Sample();
+					DoNotOptimize( ptrs );
+				} ) );
+	}
+
+	void RunExpansion( const std::size_t iterationCount )
+	{
+		PrintHeader( "EXPAND_TO_NOTNULL" );
+
+		{
+			ElementType                   element  = 7;
+			ElementType*                  rawPtr   = &element;
+			WsyNullableRaw< ElementType > nullable = rawPtr;
+
+			PrintPair(
+				Measure( "WsyNullableRaw EXPAND_TO_NOTNULL", iterationCount, nullptr, [ & ]( auto& probe ) -> int
+					{
+						DoNotOptimize( nullable );
+						EXPAND_TO_NOTNULL( nullable, notnull, 0 );
+						probe.Sample();
+
+						ElementType& value = notnull;
+						DoNotOptimize( value );
+						return 0;
+					} ),
+				Measure( "if ( !rawPtr ) return", iterationCount, nullptr, [ & ]( auto& probe ) -> int
+					{
+						DoNotOptimize( rawPtr );
+						if ( !rawPtr )
+							return 0;
+						probe.Sample();
+
+						ElementType& value = *rawPtr;
+						DoNotOptimize( value );
+						return 0;
+					} ) );
+		}
+
+		{
+			std::shared_ptr< ElementType >   sharedPtr = std::make_shared< ElementType >( 7 );
+			WsyNullableShared< ElementType > nullable  = sharedPtr;
+
+			PrintPair(
+				Measure( "WsyNullableShared EXPAND_TO_NOTNULL", iterationCount, &sharedPtr, [ & ]( auto& probe ) -> int
+					{
+						DoNotOptimize( nullable );
+						EXPAND_TO_NOTNULL( nullable, notnull, 0 );
+						probe.Sample();
+
+						ElementType& value = notnull;
+						DoNotOptimize( value );
+						return 0;
+					} ),
+				Measure( "if ( !sharedPtr ) return", iterationCount, &sharedPtr, [ & ]( auto& probe ) -> int
+					{
+						DoNotOptimize( sharedPtr );
+						if ( !sharedPtr )
+							return 0;
+						probe.Sample();
+
+						ElementType& value = *sharedPtr;
+						DoNotOptimize( value );
+						return 0;
+					} ) );
+
+			PrintPair(
+				Measure( "WsyNullableShared EXPAND_TO_NOTNULL_REF", iterationCount, &sharedPtr, [ & ]( auto& probe ) -> int
+					{
+						DoNotOptimize( nullable );
+						EXPAND_TO_NOTNULL_REF( nullable, notnullRef, 0 );
+						probe.Sample();
+
+						ElementType& value = notnullRef;
+						DoNotOptimize( value );
+						return 0;
+					} ),
+				Measure( "if ( !sharedPtr ) return", iterationCount, &sharedPtr, [ & ]( auto& probe ) -> int
+					{
+						DoNotOptimize( sharedPtr );
+						if ( !sharedPtr )
+							return 0;
+						probe.Sample();
+
+						ElementType& value = *sharedPtr;
+						DoNotOptimize( value );
+						return 0;
+					} ) );
+		}
+	}
+
+	void RunConversion( const std::size_t iterationCount )
+	{
+		PrintHeader( "NotNull -> Nullable" );
+
+		{
+			ElementType  element = 7;
+			ElementType* rawPtr  = &element;
+			auto         notnull = *ExpandOnce( WsyNullableRaw< ElementType >{ rawPtr } );
+
+			PrintPair(
+				Measure( "WsyNotNullRaw -> WsyNullableRaw", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( notnull );
+						WsyNullableRaw< ElementType > nullable = notnull;
+						probe.Sample();
+						DoNotOptimize( nullable );
+					} ),
+				Measure( "T* -> T*", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( rawPtr );
+						ElementType* copied = rawPtr;
+						probe.Sample();
+						DoNotOptimize( copied );
+					} ) );
+		}
+
+		{
+			std::shared_ptr< ElementType > sharedPtr = std::make_shared< ElementType >( 7 );
+			auto                           notnull   = *ExpandOnce( WsyNullableShared< ElementType >{ sharedPtr } );
+
+			PrintPair(
+				Measure( "WsyNotNullShared -> WsyNullableShared", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( notnull );
+						WsyNullableShared< ElementType > nullable = notnull;
+						probe.Sample();
+						DoNotOptimize( nullable );
+					} ),
+				Measure( "shared_ptr -> shared_ptr", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( sharedPtr );
+						std::shared_ptr< ElementType > copied = sharedPtr;
+						probe.Sample();
+						DoNotOptimize( copied );
+					} ) );
+		}
+	}
+
+	void RunCopyAssign( const std::size_t iterationCount )
+	{
+		PrintHeader( "Copy / Assign" );
+
+		{
+			ElementType  element   = 7;
+			ElementType* rawPtr    = &element;
+			auto         notnull   = *ExpandOnce( WsyNullableRaw< ElementType >{ rawPtr } );
+			auto         target    = notnull;
+			ElementType* rawTarget = rawPtr;
+
+			PrintPair(
+				Measure( "WsyNotNullRaw copy + assign", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( notnull );
+						auto copied = notnull;
+						target = copied;
+						probe.Sample();
+						DoNotOptimize( target );
+					} ),
+				Measure( "T* copy + assign", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( rawPtr );
+						auto copied = rawPtr;
+						rawTarget = copied;
+						probe.Sample();
+						DoNotOptimize( rawTarget );
+					} ) );
+		}
+
+		{
+			std::shared_ptr< ElementType > sharedPtr    = std::make_shared< ElementType >( 7 );
+			auto                           notnull      = *ExpandOnce( WsyNullableShared< ElementType >{ sharedPtr } );
+			auto                           target       = notnull;
+			std::shared_ptr< ElementType > sharedTarget = sharedPtr;
+
+			PrintPair(
+				Measure( "WsyNotNullShared copy + assign", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( notnull );
+						auto copied = notnull;
+						target = copied;
+						probe.Sample();
+						DoNotOptimize( target );
+					} ),
+				Measure( "shared_ptr copy + assign", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( sharedPtr );
+						auto copied = sharedPtr;
+						sharedTarget = copied;
+						probe.Sample();
+						DoNotOptimize( sharedTarget );
+					} ) );
+		}
+
+		// 레퍼런스 카운트의 원자 연산 유무를 비교합니다. ( LocalSharedPtr의 refOps는 원자적이지 않은 증가 + 감소 횟수입니다. )
+		{
+			auto notnull = WsyNotNullLocalShared< ElementType >::EmplaceNotNull( 7 );
+			auto target  = notnull;
+
+			std::shared_ptr< ElementType > sharedPtr     = std::make_shared< ElementType >( 7 );
+			auto                           sharedNotnull = *ExpandOnce( WsyNullableShared< ElementType >{ sharedPtr } );
+			auto                           sharedTarget  = sharedNotnull;
+
+			PrintPair(
+				Measure( "WsyNotNullLocalShared copy + assign", iterationCount, &notnull, [ & ]( auto& probe )
+					{
+						DoNotOptimize( notnull );
+						auto copied = notnull;
+						target = copied;
+						probe.Sample();
+						DoNotOptimize( target );
+					} ),
+				Measure( "WsyNotNullShared copy + assign", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( sharedNotnull );
+						auto copied = sharedNotnull;
+						sharedTarget = copied;
+						probe.Sample();
+						DoNotOptimize( sharedTarget );
+					} ) );
+		}
+
+		// 메모리 크기( 8 : 16바이트 )와 캐시 미스의 차이를 보기 위한 비교입니다. ( 둘 다 원자 연산을 사용합니다. )
+		{
+			auto notnull = WsyNotNullIntrusive< IntrusiveElement >::EmplaceNotNull( 7 );
+			auto target  = notnull;
+
+			std::shared_ptr< ElementType > sharedPtr     = std::make_shared< ElementType >( 7 );
+			auto                           sharedNotnull = *ExpandOnce( WsyNullableShared< ElementType >{ sharedPtr } );
+			auto                           sharedTarget  = sharedNotnull;
+
+			PrintPair(
+				Measure( "WsyNotNullIntrusive copy + assign", iterationCount, &notnull, [ & ]( auto& probe )
+					{
+						DoNotOptimize( notnull );
+						auto copied = notnull;
+						target = copied;
+						probe.Sample();
+						DoNotOptimize( target );
+					} ),
+				Measure( "WsyNotNullShared copy + assign", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( sharedNotnull );
+						auto copied = sharedNotnull;
+						sharedTarget = copied;
+						probe.Sample();
+						DoNotOptimize( sharedTarget );
+					} ) );
+		}
+
+		{
+			std::shared_ptr< ElementType > sharedPtr    = std::make_shared< ElementType >( 7 );
+			auto                           notnull      = *ExpandOnce( WsyNullableShared< ElementType >{ sharedPtr } );
+			auto                           target       = *ExpandOnce( WsyNullableShared< ElementType >{ std::make_shared< ElementType >( 3 ) } );
+			std::shared_ptr< ElementType > sharedTarget = std::make_shared< ElementType >( 3 );
+
+			PrintPair(
+				Measure( "WsyNotNullShared move-assign round trip", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						target = std::move( notnull );
+						notnull = std::move( target );
+						probe.Sample();
+						DoNotOptimize( notnull );
+						DoNotOptimize( target );
+					} ),
+				Measure( "shared_ptr move-assign round trip", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						std::swap( sharedPtr, sharedTarget );
+						std::swap( sharedPtr, sharedTarget );
+						probe.Sample();
+						DoNotOptimize( sharedPtr );
+						DoNotOptimize( sharedTarget );
+					} ) );
+
+			PrintPair(
+				Measure( "WsyNotNullShared -> Nullable ( move )", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						WsyNullableShared< ElementType > nullable = std::move( notnull );
+						probe.Sample();
+
+						// 측정을 반복하기 위해, 다시 notnull로 옮겨둡니다.
+						EXPAND_TO_NOTNULL_MOVE( nullable, restored, RETURN_VOID );
+						notnull = std::move( restored );
+						DoNotOptimize( notnull );
+					} ),
+				Measure( "shared_ptr -> shared_ptr ( move )", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						std::shared_ptr< ElementType > moved = std::move( sharedPtr );
+						probe.Sample();
+
+						if ( !moved )
+							return;
+
+						sharedPtr = std::move( moved );
+						DoNotOptimize( sharedPtr );
+					} ) );
+		}
+
+		{
+			// unique_ptr은 복사가 불가능하므로, 이동 할당을 왕복하여 측정합니다.
+			auto notnull      = WsyNotNullUnique< ElementType >::MakeNotNull( 7 );
+			auto target       = WsyNotNullUnique< ElementType >::MakeNotNull( 3 );
+			auto uniquePtr    = std::make_unique< ElementType >( 7 );
+			auto uniqueTarget = std::make_unique< ElementType >( 3 );
+
+			PrintPair(
+				Measure( "WsyNotNullUnique move-assign round trip", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						std::swap( notnull, target );
+						probe.Sample();
+						DoNotOptimize( notnull );
+						DoNotOptimize( target );
+					} ),
+				Measure( "unique_ptr move-assign round trip", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						std::swap( uniquePtr, uniqueTarget );
+						probe.Sample();
+						DoNotOptimize( uniquePtr );
+						DoNotOptimize( uniqueTarget );
+					} ) );
+		}
+	}
+
+	void RunAccess( const std::size_t iterationCount )
+	{
+		PrintHeader( "operator ElementType&" );
+
+		{
+			ElementType  element = 7;
+			ElementType* rawPtr  = &element;
+			auto         notnull = *ExpandOnce( WsyNullableRaw< ElementType >{ rawPtr } );
+
+			PrintPair(
+				Measure( "WsyNotNullRaw access", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( notnull );
+						ElementType& value = notnull;
+						probe.Sample();
+						DoNotOptimize( value );
+					} ),
+				Measure( "*rawPtr", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( rawPtr );
+						ElementType& value = *rawPtr;
+						probe.Sample();
+						DoNotOptimize( value );
+					} ) );
+		}
+
+		{
+			std::shared_ptr< ElementType > sharedPtr = std::make_shared< ElementType >( 7 );
+			auto                           notnull   = *ExpandOnce( WsyNullableShared< ElementType >{ sharedPtr } );
+
+			PrintPair(
+				Measure( "WsyNotNullShared access", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( notnull );
+						ElementType& value = notnull;
+						probe.Sample();
+						DoNotOptimize( value );
+					} ),
+				Measure( "*sharedPtr", iterationCount, &sharedPtr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( sharedPtr );
+						ElementType& value = *sharedPtr;
+						probe.Sample();
+						DoNotOptimize( value );
+					} ) );
+		}
+
+		{
+			auto notnull   = WsyNotNullUnique< ElementType >::MakeNotNull( 7 );
+			auto uniquePtr = std::make_unique< ElementType >( 7 );
+
+			PrintPair(
+				Measure( "WsyNotNullUnique access", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( notnull );
+						ElementType& value = notnull;
+						probe.Sample();
+						DoNotOptimize( value );
+					} ),
+				Measure( "*uniquePtr", iterationCount, nullptr, [ & ]( auto& probe )
+					{
+						DoNotOptimize( uniquePtr );
+						ElementType& value = *uniquePtr;
+						probe.Sample();
+						DoNotOptimize( value );
+					} ) );
+		}
+	}
+
+	// 대부분이 null인 Nullable< T* > 배열 하나를 순회하는 비용입니다. ( 1 op = ScanElementCount개 )
+	void RunNullScan( const std::size_t iterationCount )
+	{
+		constexpr std::size_t ScanElementCount = 1024;
+
+		PrintHeader( "Null scan ( 1024 elements, 75% null )" );
+
+		std::vector< ElementType >                   elements( ScanElementCount, 7 );
+		std::vector< WsyNullableRaw< ElementType > > nullables( ScanElementCount );
+		std::vector< ElementType* >                  rawPtrs( ScanElementCount, nullptr );
+		std::vector< std::uint32_t >                 indices( ScanElementCount );
+
+		// 분기 예측이 어렵도록, 무작위로 채웁니다.
+		std::mt19937 random( 7 );
+		for ( std::size_t index = 0; index < ScanElementCount; ++index )
+		{
+			if ( random() % 4 == 0 )
+			{
+				nullables[ index ] = &elements[ index ];
+				rawPtrs[ index ]   = &elements[ index ];
+			}
+		}
+
+		const std::size_t scanCount = std::max< std::size_t >( iterationCount / ScanElementCount, 1 );
+
+		PrintPair(
+			Measure( "CompactNotNullIndices + dense loop", scanCount, nullptr, [ & ]( auto& probe )
+				{
+					DoNotOptimize( nullables );
+					const std::size_t count = WonSY::CompactNotNullIndices( nullables, std::span< std::uint32_t >( indices ) );
+					probe.Sample();
+
+					ElementType sum = 0;
+					for ( std::size_t index = 0; index < count; ++index )
+						sum += *rawPtrs[ indices[ index ] ];
+
+					DoNotOptimize( sum );
+				} ),
+			Measure( "for ( rawPtr ) if ( rawPtr ) sum", scanCount, nullptr, [ & ]( auto& probe )
+				{
+					DoNotOptimize( rawPtrs );
+					probe.Sample();
+
+					ElementType sum = 0;
+					for ( ElementType* const rawPtr : rawPtrs )
+					{
+						if ( rawPtr )
+							sum += *rawPtr;
+					}
+
+					DoNotOptimize( sum );
+				} ) );
+	}
+}
+
+int main( int argc, char* argv[] )
+{
+	using namespace WonSY::Benchmark;
+
+	const std::size_t iterationCount = argc > 1 ? std::strtoull( argv[ 1 ], nullptr, 10 ) : DefaultIterationCount;
+	if ( !iterationCount )
+	{
+		std::printf( "usage : %s [ IterationCount ]\n", argv[ 0 ] );
+		return 1;
+	}
+
+	// libstdc++의 shared_ptr이 원자 연산을 생략하지 않도록, 스레드를 한 번 생성합니다.
+	std::thread( [] {} ).join();
+
+	std::printf( "WonSY NotNull / Nullable Benchmark ( iterations : %zu )\n", iterationCount );
+
+	RunConstruction     ( iterationCount );
+	RunArenaConstruction( iterationCount );
+	RunPoolConstruction ( iterationCount );
+	RunBatchConstruction( iterationCount );
+	RunExpansion        ( iterationCount );
+	RunConversion       ( iterationCount );
+	RunCopyAssign       ( iterationCount );
+	RunAccess           ( iterationCount );
+	RunNullScan         ( iterationCount );
+
+	return 0;
+}
@@ -4,11 +4,81 @@
 		github.com/GameForPeople
 */
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <map>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "include/WonSY_NotNull.h"
 #include "include/WonSY_Nullable.h"
+#include "include/WonSY_NotNullRef.h"
+#include "include/WonSY_NotNullPool.h"
+#include "include/WonSY_NotNullBatch.h"
+#include "include/WonSY_SlotMap.h"
+#include "include/WonSY_PointerCast.h"
+#include "include/WonSY_NotNullFlatMap.h"
+#include "include/WonSY_NotNullCache.h"
+#include "include/WonSY_LazyNotNull.h"
+#include "include/WonSY_AtomicNotNull.h"
+#include "include/WonSY_NotNullQueue.h"
+#include "include/WonSY_EpochPtr.h"
+#include "include/WonSY_AsyncNotNullCache.h"
+#include "include/WonSY_NotNullViews.h"
+#include "include/WonSY_NullableScan.h"
+
+
+/// [예제E3]에서 사용하는, 사내 핸들 타입을 NotNull, Nullable에 연결하는 예시입니다.
+namespace Game
+{
+	struct Entity
+	{
+		int id;
+		int hp;
+	};
+
+	// 전역 테이블의 인덱스로 Entity를 가리키는 핸들입니다. ( -1이 null을 의미합니다. )
+	class EntityHandle
+	{
+	public:
+		inline static Entity s_table[ 16 ]{};
+		inline static int    s_nextIndex = 0;
+
+		int index = -1;
+
+		EntityHandle( std::nullptr_t = nullptr ) noexcept {}
+		explicit EntityHandle( const int inIndex ) noexcept : index{ inIndex } {}
+	};
+}
+
+// PointerTraits를 특수화하면, EntityHandle을 래퍼 없이 NotNull, Nullable로 사용할 수 있습니다.
+template <>
+class WonSY::PointerTraits< Game::EntityHandle >
+	: public WonSY::PointerTraitsBase< Game::EntityHandle, Game::Entity >
+{
+public:
+	static bool IsNull( const Game::EntityHandle& handle ) noexcept
+	{
+		return handle.index < 0;
+	}
+
+	static Game::Entity& Deref( const Game::EntityHandle& handle ) noexcept
+	{
+		return Game::EntityHandle::s_table[ handle.index ];
+	}
+
+	static Game::EntityHandle Make( const int id, const int hp ) noexcept
+	{
+		const int index = Game::EntityHandle::s_nextIndex++;
+		Game::EntityHandle::s_table[ index ] = Game::Entity{ id, hp };
+		return Game::EntityHandle( index );
+	}
+};
 
 
 int main()
@@ -115,6 +185,7 @@ int main()
 
 				// ! 이 상태에서, 
 				//	0. _Type이 RawPointer이고, 확장한 nullable을 Release해버리면,        원본 notnull은 댕글링됩니다.
+				//	   ( 다른 스레드에서 Release될 수 있다면, 예제E12의 Nullable< EpochPtr< T > >를 사용합니다. )
 				//	1. _Type이 RawPointer이고, 확장한 nullable에 nullptr를 할당해버리고, 원본 nullable을 Release하지 않으면, 메모리릭이 발생합니다.
 			}
 
@@ -129,6 +200,7 @@ int main()
 			}
 
 			// EXPAND_TO_NOTNULL외에도, EXPAND_TO_NOTNULL_CONTINUE 등의 확장 매크로 기능이 존재합니다.
+			// Nullable의 컨테이너를 순회할 때는, views::expand_not_null로 null을 건너뛰며 확장할 수 있습니다. ( [예제E14] )
 
 			return 0;
 		}();
@@ -159,6 +231,198 @@ int main()
 		// notnull 객체에서, nullable 객체로의 변환 또한 당연히 항상 성공하므로 허용합니다.
 		WsyNullable< _Type > nullable = notnull;
 		nullable = notnull;
+
+		/// 예제B1. ElementType의 생성자 인자를 그대로 전달하여, 복사 없이 제자리에서 생성합니다.
+		{
+			// 복사도, 이동도 불가능한 타입이라도 생성이 가능합니다.
+			struct HeavyEntity
+			{
+				int id;
+				int hp;
+
+				HeavyEntity( const int inId, const int inHp ) : id{ inId }, hp{ inHp } {}
+				HeavyEntity( const HeavyEntity& ) = delete;
+				HeavyEntity( HeavyEntity&& )      = delete;
+			};
+
+			WsyNotNull< std::shared_ptr< HeavyEntity > > entity = WsyNotNull< std::shared_ptr< HeavyEntity > >::EmplaceNotNull( 7, 100 );
+			std::cout << "[B1 - 0] entity hp is " << entity().hp << std::endl;
+
+			WsyNullable< std::shared_ptr< HeavyEntity > > nullableEntity = WsyNullable< std::shared_ptr< HeavyEntity > >::EmplaceNullable( 3, 50 );
+			if ( nullableEntity )
+				std::cout << "[B1 - 1] nullableEntity is valid!" << std::endl;
+		}
+
+		/// 예제B2. 전역 힙 대신, Allocator( memory_resource )에서 할당합니다.
+		{
+			// 프레임 단위로 생성되고 함께 사라지는 개체들은, monotonic arena에서 할당 후 한번에 해제할 수 있습니다.
+			std::pmr::monotonic_buffer_resource frameArena;
+
+			WsyNotNull< std::shared_ptr< int > > sharedNotnull = WsyNotNull< std::shared_ptr< int > >::AllocateNotNull( &frameArena, elementValue0 );
+			WsyNotNullUniquePmr< int >           uniqueNotnull = WsyNotNullUniquePmr< int >::AllocateNotNull( &frameArena, elementValue1 );
+			std::cout << "[B2 - 0] arena notnull Values are " << sharedNotnull << ", " << uniqueNotnull << std::endl;
+
+			// RawPtr의 경우, delete 대신 같은 memory_resource로 Release하여야 합니다.
+			WsyNullable< int* > rawNullable = WsyNullable< int* >::AllocateNullable( &frameArena, elementValue0 );
+			rawNullable.Release( &frameArena );
+
+			// frameArena가 소멸되면서, 할당된 메모리가 한번에 해제됩니다.
+		}
+
+		/// 예제B3. 자주 생성되고 사라지는 개체는, NotNullPool에서 재사용합니다.
+		{
+			{
+				// 마지막 참조가 사라지면, 메모리는 해제되지 않고 스레드별 FreeList로 돌아갑니다.
+				WsyNotNull< std::shared_ptr< int > > pooledNotnull = WsyNotNullPool< int >::AcquireNotNull( elementValue0 );
+				std::cout << "[B3 - 0] pooled notnull Value is " << pooledNotnull << std::endl;
+			}
+
+			// 이번에는 FreeList에서 꺼내오므로, 힙 할당이 발생하지 않습니다.
+			WsyNullable< std::shared_ptr< int > > pooledNullable = WsyNotNullPool< int >::AcquireNullable( elementValue1 );
+
+			const auto stats = WsyNotNullPool< int >::GetStats();
+			std::cout << "[B3 - 1] pool hit : " << stats.hitCount << ", miss : " << stats.missCount << ", highWaterMark : " << stats.highWaterMark << std::endl;
+		}
+
+		/// 예제B4. 작은 값 타입은, Inline< T >로 힙 할당 없이 NotNull을 만들 수 있습니다.
+		{
+			// shared_ptr< int >처럼 사용하지만, 컨트롤 블록과 힙 할당이 없습니다.
+			WsyNotNullInline< int > inlineNotnull = WsyNotNullInline< int >::MakeNotNull( elementValue0 );
+			inlineNotnull = elementValue1;
+			std::cout << "[B4 - 0] inline notnull Value is " << inlineNotnull << ", size is " << sizeof( inlineNotnull ) << std::endl;
+
+			// 다만 포인터가 아닌 값이므로, 복사 및 nullable로의 변환은 값을 복사합니다.
+			WsyNullableInline< int > inlineNullable = inlineNotnull;
+			inlineNotnull = elementValue0;
+
+			[ & ]()
+			{
+				EXPAND_TO_NOTNULL( inlineNullable, notnull, RETURN_VOID );
+
+				// 3 ( inlineNotnull의 변경이 반영되지 않습니다. )
+				std::cout << "[B4 - 1] inline nullable Value is " << notnull << std::endl;
+			}();
+		}
+
+		/// 예제B5. 많은 수의 NotNull을 한번에 생성할 때는, MakeNotNullBatch로 한번의 할당으로 생성할 수 있습니다.
+		{
+			// 100개의 int( elementValue0 )와 레퍼런스 카운트가 하나의 연속된 블록에 할당됩니다.
+			const auto batch = WonSY::MakeNotNullBatch< int >( 100, elementValue0 );
+
+			// 꺼내온 NotNull은 추가 할당 없이, 블록의 수명을 공유합니다.
+			WsyNotNullShared< int > notnull = batch[ 10 ];
+			notnull = elementValue1;
+
+			int sum = 0;
+			for ( std::size_t index = 0; index < batch.size(); ++index )
+				sum += batch.GetRef( index );
+
+			// 3 + 99 * 2 = 201
+			std::cout << "[B5 - 0] batch sum is " << sum << ", use count is " << batch.GetUseCount() << std::endl;
+		}
+
+		/// 예제B6. IntrusivePtr< T >를 사용하면, 레퍼런스 카운트가 개체 내부에 있어 NotNull, Nullable이 포인터 크기가 됩니다.
+		{
+			// IntrusiveRefCounted< T >를 상속하여, 개체 내부에 레퍼런스 카운트를 둡니다.
+			struct Monster
+				: public WonSY::IntrusiveRefCounted< Monster >
+			{
+				int hp;
+
+				explicit Monster( const int inHp ) : hp{ inHp } {}
+			};
+
+			WsyNotNullIntrusive< Monster > monster = WsyNotNullIntrusive< Monster >::EmplaceNotNull( 100 );
+			WsyNullableIntrusive< Monster > nullableMonster = monster;
+
+			// 8 ( 64bit 기준, shared_ptr은 16 )
+			std::cout << "[B6 - 0] intrusive notnull size is " << sizeof( monster ) << ", use count is " << monster.GetUseCount() << std::endl;
+
+			[ & ]()
+			{
+				EXPAND_TO_NOTNULL( nullableMonster, notnull, RETURN_VOID );
+
+				std::cout << "[B6 - 1] monster hp is " << notnull().hp << std::endl;
+			}();
+		}
+
+		/// 예제B7. 한 스레드에서만 사용하는 데이터는, LocalSharedPtr< T >로 레퍼런스 카운트의 원자 연산 없이 공유할 수 있습니다.
+		{
+			WsyNotNullLocalShared< int > localNotnull = WsyNotNullLocalShared< int >::MakeNotNull( elementValue0 );
+
+			// 복사 시 레퍼런스 카운트가 일반 정수로 증가합니다. ( 다른 스레드에서 복사, 소멸하면 디버그 빌드에서 assert 됩니다. )
+			WsyNullableLocalShared< int > localNullable = localNotnull;
+
+			[ & ]()
+			{
+				EXPAND_TO_NOTNULL( localNullable, notnull, RETURN_VOID );
+
+				// 7
+				std::cout << "[B7 - 0] local shared Value is " << notnull << ", use count is " << notnull.GetUseCount() << std::endl;
+			}();
+		}
+
+		/// 예제B8. RawPointer에 flag가 필요할 때는, TaggedPtr< T >로 포인터의 하위 비트에 소유권과 Tag를 함께 담을 수 있습니다.
+		{
+			// Tag는 비트 인덱스를 값으로 가지는 enum으로 정의합니다. ( alignof( T )가 8이면 0번 비트( 소유권 )를 제외한 2개를 사용할 수 있습니다. )
+			enum class EntityFlag { Dirty = 0, PendingDelete = 1 };
+
+			struct alignas( 8 ) Entity
+			{
+				int hp;
+			};
+
+			using EntityPtr = WsyTaggedPtr< Entity, EntityFlag >;
+
+			Entity borrowedEntity{ 50 };
+
+			// 빌려온 포인터와, 소유권을 가진 포인터가 같은 테이블에 8바이트로 담깁니다.
+			WsyNullableTagged< Entity, EntityFlag > table[ 2 ] = {
+				EntityPtr( &borrowedEntity ),
+				WsyNullableTagged< Entity, EntityFlag >::EmplaceNullable( 100 ) };
+
+			table[ 1 ].SetTag( EntityFlag::Dirty );
+
+			for ( auto& entry : table )
+			{
+				EXPAND_TO_NOTNULL_REF_CONTINUE( entry, entity );
+
+				std::cout << "[B8 - 0] entity hp is " << entity().hp << ", owner : " << entry.IsOwner() << ", dirty : " << entry.HasTag( EntityFlag::Dirty ) << ", size is " << sizeof( entry ) << std::endl;
+			}
+
+			// Owner일 때만 delete하므로, 빌려온 포인터에 Release를 호출해도 안전합니다.
+			for ( auto& entry : table )
+				entry.Release();
+		}
+
+		/// 예제B9. 다른 곳에서 Release될 수 있는 개체는, SlotHandle< T >로 레퍼런스 카운트 없이 댕글링을 막을 수 있습니다.
+		{
+			// SlotMap< int >에 생성되며, 핸들은 ( index, generation ) 8바이트입니다.
+			WsyNullableSlot< int > owner    = WsyNullableSlot< int >::MakeNullable( elementValue0 );
+			WsyNullableSlot< int > observer = owner;
+
+			// 예제A0의 RawPtr과 달리, owner에서 Release하면 observer도 null이 됩니다.
+			owner.Release();
+
+			[ & ]()
+			{
+				EXPAND_TO_NOTNULL_EX( observer, notnull, RETURN_VOID,
+					std::cout << "[B9 - 0] observer is nullptr after Release, size is " << sizeof( observer ) << std::endl; );
+
+				std::cout << "[B9 - 0] Never Called, " << notnull << std::endl;
+			}();
+
+			// SlotMap의 ElementType들은 빈틈 없이 저장되어, 선형으로 순회할 수 있습니다.
+			for ( int value = 0; value < 4; ++value )
+				(void)WsySlotMap< int >::GetInstance().Emplace( value );
+
+			int sum = 0;
+			for ( const int value : WsySlotMap< int >::GetInstance().GetValues() )
+				sum += value;
+
+			// 6
+			std::cout << "[B9 - 1] slot map sum is " << sum << std::endl;
+		}
 	}
 
 	/// [예제C] 함수 반환 값에서의 활용 예제입니다.
@@ -207,7 +471,8 @@ int main()
 		{
 			auto nullable = Get( invalidValue );
 
-			EXPAND_TO_NOTNULL( nullable, notnull, RETURN_VOID );
+			// nullable을 이후에 사용하지 않는다면, EXPAND_TO_NOTNULL_MOVE로 복사 없이 옮겨서 확장할 수 있습니다.
+			EXPAND_TO_NOTNULL_MOVE( nullable, notnull, RETURN_VOID );
 
 			// Get의 결과가 유효하지 않을 것이므로, 이 부분은 호출되지 않습니다.
 			std::cout << "[C0 - 0] notnull Value is " << notnull << std::endl;
@@ -218,6 +483,9 @@ int main()
 		std::cout << "[C0 - 1] notnull Value is " << notnull << std::endl;
 
 		// 결과적으로 함수 반환 값에 notnull과 nullable을 사용함으로서, 함수의 의도를 더 온전히 담을 수 있습니다.
+
+		// 여러 스레드에서 사용하는 Get, Acquire는 NotNullCache로 제공됩니다. ( [예제E8] )
+		// 생성( 디스크 로드 등 )을 코루틴으로 기다리는 Get, Acquire는 AsyncNotNullCache로 제공됩니다. ( [예제E13] )
 	}
 
 	/// [예제D] 함수 인자에서의 활용 예제입니다.
@@ -376,6 +644,466 @@ int main()
 				std::cout << "[E0 - 6] shared_ptr Use Count : " << sharedPtr.use_count() << std::endl;
 			}
 		}
+
+		/// E1. 레퍼런스 카운트 변화 없이 확장하기 ( EXPAND_TO_NOTNULL_REF )
+		{
+			WsySharedPtr< int > sharedPtr = std::make_shared< int >( 7 );
+			WsyNullable< WsySharedPtr< int > > nullable = sharedPtr;
+
+			// 소유권이 필요없는 함수라면, WsyNotNullRef< ElementType >를 값으로 받도록 작성합니다. ( 포인터 하나 크기입니다. )
+			const auto DoSomethingWithNotNullRef = []( const WsyNotNullRef< int > param )
+				{
+					std::cout << "[E1 - 1] notnullRef Value is " << param << std::endl;
+				};
+
+			[ & ]()
+			{
+				// EXPAND_TO_NOTNULL_REF는 shared_ptr을 복사하지 않는 빌려온 NotNullRef를 생성합니다.
+				// 따라서 notnullRef는 nullable의 스코프 안에서만 사용해야 합니다.
+				EXPAND_TO_NOTNULL_REF( nullable, notnullRef, RETURN_VOID );
+
+				// use_count 2
+				std::cout << "[E1 - 0] shared_ptr Use Count : " << sharedPtr.use_count() << std::endl;
+
+				DoSomethingWithNotNullRef( notnullRef );
+
+				// NotNull 또한 복사 없이 NotNullRef로 전달할 수 있습니다.
+				const auto notnull = WsyNotNullShared< int >::MakeNotNull( 3 );
+				DoSomethingWithNotNullRef( notnull );
+
+				// use_count 2
+				std::cout << "[E1 - 2] shared_ptr Use Count : " << sharedPtr.use_count() << std::endl;
+			}();
+		}
+
+		/// E2. 이동을 통한 소유권 전달 ( EXPAND_TO_NOTNULL_MOVE )
+		{
+			WsySharedPtr< int > sharedPtr = std::make_shared< int >( 7 );
+
+			// 임시 객체( rvalue )는 복사되지 않고 이동됩니다.
+			WsyNullable< WsySharedPtr< int > > nullable = WsySharedPtr< int >( sharedPtr );
+
+			// use_count 2
+			std::cout << "[E2 - 0] shared_ptr Use Count : " << sharedPtr.use_count() << std::endl;
+
+			[ & ]()
+			{
+				// nullable의 데이터를 notnull로 옮기므로, 확장 이후 nullable은 null이 됩니다.
+				EXPAND_TO_NOTNULL_MOVE( nullable, notnull, RETURN_VOID );
+
+				// use_count 2
+				std::cout << "[E2 - 1] shared_ptr Use Count : " << sharedPtr.use_count() << ", nullable is " << ( nullable ? "valid" : "nullptr" ) << std::endl;
+
+				// notnull 간의 이동 할당은 서로 교환되므로, 양쪽 모두 유효한 상태를 유지합니다.
+				auto otherNotnull = WsyNotNullShared< int >::MakeNotNull( 3 );
+				otherNotnull = std::move( notnull );
+				std::cout << "[E2 - 2] otherNotnull Value is " << otherNotnull << ", notnull Value is " << notnull << std::endl;
+
+				// 다시 nullable로 옮겨도 레퍼런스 카운트는 변하지 않습니다.
+				nullable = std::move( otherNotnull );
+
+				// use_count 2
+				std::cout << "[E2 - 3] shared_ptr Use Count : " << sharedPtr.use_count() << std::endl;
+			}();
+
+			// 함수의 반환 값( 임시 nullable )도 바로 확장할 수 있으며, 확장한 스코프 동안 유지됩니다.
+			const auto GetNullable = [ &sharedPtr ]() -> WsyNullableShared< int > { return WsySharedPtr< int >( sharedPtr ); };
+
+			[ & ]()
+			{
+				EXPAND_TO_NOTNULL( GetNullable(), notnull, RETURN_VOID );
+
+				// use_count 3 ( sharedPtr, nullable, notnull )
+				std::cout << "[E2 - 4] notnull Value is " << notnull << ", shared_ptr Use Count : " << sharedPtr.use_count() << std::endl;
+			}();
+		}
+
+		/// E3. 사용자 포인터 타입 사용하기 ( PointerTraits )
+		{
+			// 파일 상단의 PointerTraits< Game::EntityHandle > 특수화를 통해, 핸들 타입을 그대로 담습니다. ( 핸들 크기 그대로 )
+			WsyNotNull< Game::EntityHandle > entity = WsyNotNull< Game::EntityHandle >::EmplaceNotNull( 7, 100 );
+			WsyNullable< Game::EntityHandle > nullableEntity = entity;
+
+			[ & ]()
+			{
+				EXPAND_TO_NOTNULL( nullableEntity, notnull, RETURN_VOID );
+
+				std::cout << "[E3 - 0] entity id is " << notnull().id << ", hp is " << notnull().hp << ", size is " << sizeof( notnull ) << std::endl;
+			}();
+		}
+
+		/// E4. weak_ptr 관찰하기 ( Nullable< weak_ptr > )
+		{
+			WsyNotNullShared< int > owner = WsyNotNullShared< int >::MakeNotNull( 7 );
+
+			// 레퍼런스 카운트를 증가시키지 않고 관찰합니다.
+			WsyNullableWeak< int > observer = owner;
+
+			[ & ]()
+			{
+				// null 확인만 필요할 때는, lock() 없이 expired()로 확인합니다.
+				if ( !observer )
+					return;
+
+				// 확장 시 한번만 lock()하여, NotNull< shared_ptr >로 확장합니다.
+				EXPAND_TO_NOTNULL( observer, notnull, RETURN_VOID );
+
+				// use_count 2
+				std::cout << "[E4 - 0] notnull Value is " << notnull << ", Use Count : " << notnull.GetUseCount() << std::endl;
+			}();
+
+			[ & ]()
+			{
+				// _REF는 lock()한 shared_ptr을 스코프 동안 유지하며, 이를 빌려온 NotNullRef로 확장합니다.
+				EXPAND_TO_NOTNULL_REF( observer, notnullRef, RETURN_VOID );
+
+				std::cout << "[E4 - 1] notnullRef Value is " << notnullRef << std::endl;
+			}();
+
+			// owner가 사라지면, observer는 null이 됩니다.
+			owner = WsyNotNullShared< int >::MakeNotNull( 3 );
+
+			[ & ]()
+			{
+				EXPAND_TO_NOTNULL_EX( observer, notnull, RETURN_VOID,
+					std::cout << "[E4 - 2] observer is expired" << std::endl; );
+
+				std::cout << "[E4 - 2] Never Called, " << notnull << std::endl;
+			}();
+		}
+
+		/// E5. 독점 소유권 ( Nullable< unique_ptr > )
+		{
+			WsyNullableUnique< int > owner = WsyNullableUnique< int >::EmplaceNullable( 7 );
+
+			[ & ]()
+			{
+				// 소유권을 옮기지 않고, 빌려온 NotNull< int* >로 확장합니다. ( owner의 스코프 안에서만 사용해야 합니다. )
+				EXPAND_TO_NOTNULL( owner, notnull, RETURN_VOID );
+
+				std::cout << "[E5 - 0] notnull Value is " << notnull << ", owner is " << ( owner ? "valid" : "nullptr" ) << std::endl;
+			}();
+
+			// 소유권이 필요할 때는, EXPAND_TO_NOTNULL_MOVE로 NotNull< unique_ptr >로 옮깁니다.
+			const auto TakeOwnership = []( WsyNullableUnique< int >& nullable ) -> WsyNullableUnique< int >
+				{
+					EXPAND_TO_NOTNULL_MOVE( nullable, notnull, nullptr );
+
+					notnull = 3;
+					return notnull;
+				};
+
+			WsyNullableUnique< int > other = TakeOwnership( owner );
+			std::cout << "[E5 - 1] owner is " << ( owner ? "valid" : "nullptr" ) << ", other is " << ( other ? "valid" : "nullptr" ) << std::endl;
+
+			// Release()는 소유한 ElementType을 해제합니다.
+			other.Release();
+		}
+
+		/// E6. Base, Derived 간의 변환 ( 업캐스트, StaticCast, DynamicCast, ConstCast )
+		{
+			struct Unit
+			{
+				virtual ~Unit() = default;
+				int hp = 100;
+			};
+
+			struct Monster : Unit
+			{
+				int exp = 7;
+			};
+
+			struct Npc : Unit
+			{
+			};
+
+			WsyNotNullShared< Monster > monster = WsyNotNullShared< Monster >::EmplaceNotNull();
+
+			// 업캐스트는 암시적으로 변환되며, 컨트롤 블록을 공유하므로 추가 할당이 없습니다.
+			WsyNotNullShared< Unit > unit = monster;
+
+			// use_count 2
+			std::cout << "[E6 - 0] shared_ptr Use Count : " << monster.GetUseCount() << std::endl;
+
+			// StaticCast는 NotNull을 유지합니다.
+			WsyNotNullShared< Monster > castedMonster = WonSY::StaticCast< Monster >( unit );
+			std::cout << "[E6 - 1] exp is " << castedMonster().exp << std::endl;
+
+			// DynamicCast는 실패할 수 있으므로, Nullable을 반환합니다.
+			WsyNullableShared< Npc > npc = WonSY::DynamicCast< Npc >( unit );
+
+			[ & ]()
+			{
+				EXPAND_TO_NOTNULL_EX( npc, notnull, RETURN_VOID,
+					std::cout << "[E6 - 2] unit is not Npc" << std::endl; );
+
+				std::cout << "[E6 - 2] Never Called, " << notnull().hp << std::endl;
+			}();
+
+			// rvalue를 캐스트하면, 레퍼런스 카운트 변화 없이 옮겨집니다.
+			WsyNullableShared< Monster > movedMonster = WonSY::DynamicCast< Monster >( std::move( unit ) );
+
+			// use_count 3
+			std::cout << "[E6 - 3] shared_ptr Use Count : " << monster.GetUseCount() << std::endl;
+
+			// unique_ptr은 rvalue에서 소유권을 옮기며, shared_ptr로도 변환할 수 있습니다.
+			WsyNotNullUnique< Unit > uniqueUnit = WsyNotNullUnique< Monster >::EmplaceNotNull();
+			WsyNullableShared< Unit > sharedUnit = std::move( uniqueUnit );
+
+			// const ElementType은 ConstCast로 되돌립니다.
+			WsyNotNullShared< const Monster > constMonster = monster;
+			WsyNotNullShared< Monster > mutableMonster = WonSY::ConstCast< Monster >( constMonster );
+			std::cout << "[E6 - 4] sharedUnit is " << ( sharedUnit ? "valid" : "nullptr" ) << ", hp is " << mutableMonster().hp << std::endl;
+		}
+
+		/// E7. 비교, 해시와 NotNullFlatMap ( 가리키는 개체로 비교합니다. )
+		{
+			int values[ 3 ]{ 30, 10, 20 };
+
+			std::vector< WsyNotNull< int* > > notnulls;
+			for ( int& value : values )
+				notnulls.push_back( WsyNotNull< int* >::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( &value ) );
+
+			// 정렬은 ElementType의 값이 아닌, 주소로 정렬됩니다.
+			std::sort( notnulls.begin(), notnulls.end() );
+
+			// NotNull, Nullable은 std::unordered_set 등의 키로 사용할 수 있습니다.
+			std::unordered_set< WsyNotNull< int* > > notnullSet( notnulls.begin(), notnulls.end() );
+
+			WsyNullable< int* > nullable( &values[ 0 ] );
+			std::cout << "[E7 - 0] front is " << notnulls.front() << ", set size is " << notnullSet.size() << ", equal is " << ( nullable == notnulls.front() ) << std::endl;
+
+			// NotNullFlatMap은 노드 할당 없이, 하나의 배열에 키와 Value를 담습니다.
+			WsyNotNullFlatMap< int*, int > hitCounts;
+			for ( const auto& notnull : notnulls )
+				hitCounts[ notnull ] += notnull;
+
+			++hitCounts[ notnulls.front() ];
+
+			// 탐색은 Nullable< Value* >를 반환합니다.
+			[ & ]()
+			{
+				auto found = hitCounts.Find( notnulls.front() );
+				EXPAND_TO_NOTNULL( found, foundCount, RETURN_VOID );
+
+				std::cout << "[E7 - 1] hitCount is " << foundCount << ", size is " << hitCounts.size() << std::endl;
+			}();
+		}
+
+		/// E8. 여러 스레드에서 사용하는 Get, Acquire ( NotNullCache )
+		{
+			// shard마다 lock이 나뉘어 있으며, Get은 shared lock만 사용합니다.
+			WsyNotNullCache< int, int > cache;
+			const int defaultValue = 7;
+			const int invalidValue = 4;
+
+			// Get은 Nullable을 반환합니다.
+			[ & ]()
+			{
+				auto nullable = cache.Get( invalidValue );
+				EXPAND_TO_NOTNULL_MOVE( nullable, notnull, RETURN_VOID );
+
+				std::cout << "[E8 - 0] Never Called, " << notnull << std::endl;
+			}();
+
+			// Acquire는 NotNull을 반환하며, 같은 key로 동시에 호출되더라도 생성은 한 번만 일어납니다.
+			auto notnull = cache.Acquire( invalidValue, defaultValue );
+
+			// 생성이 오래 걸리는 경우, factory는 lock 밖에서 호출됩니다.
+			auto otherNotnull = cache.AcquireWith( invalidValue + 1, []( const int key ) { return WsyNotNullShared< int >::MakeNotNull( key * 10 ); } );
+			std::cout << "[E8 - 1] notnull Value is " << notnull << ", otherNotnull Value is " << otherNotnull << ", size is " << cache.size() << std::endl;
+
+			// 캐시 외에 참조하는 곳이 없는 요소는 EvictUnused로 제거할 수 있습니다.
+			otherNotnull = notnull;
+			std::cout << "[E8 - 2] evicted count is " << cache.EvictUnused() << ", size is " << cache.size() << std::endl;
+		}
+
+		/// E9. 처음 접근할 때 생성하기 ( LazyNotNull )
+		{
+			class Server
+			{
+			public:
+				// 생성 비용이 큰 멤버는, Server의 생성 시점이 아닌 처음 접근할 때 생성됩니다.
+				WsyLazyNotNullShared< std::map< int, int > > rankTable;
+
+				// factory를 지정할 수 있으며, 한 스레드에서만 사용한다면 Confined로 원자 연산을 피할 수 있습니다.
+				WsyLocalLazyNotNull< std::shared_ptr< int > > config{ []() { return WsyNotNullShared< int >::MakeNotNull( 7 ); } };
+			};
+
+			Server server;
+			std::cout << "[E9 - 0] rankTable is " << ( server.rankTable.IsCreated() ? "created" : "not created" ) << std::endl;
+
+			// 처음 접근할 때 생성되며, 이후에는 NotNull처럼 사용합니다.
+			server.rankTable()[ 1 ] = 100;
+
+			// const NotNull< Type >&, Nullable< Type >으로 변환됩니다.
+			const WsyNotNullShared< std::map< int, int > >& rankTable = server.rankTable;
+			std::cout << "[E9 - 1] rankTable size is " << rankTable().size() << ", config is " << server.config << std::endl;
+		}
+
+		/// E10. 읽기 위주의 데이터를 lock 없이 교체하기 ( AtomicNotNull )
+		{
+			struct Config
+			{
+				int maxUser;
+			};
+
+			WsyAtomicNotNullShared< Config > config( WsyNotNullShared< Config >::MakeNotNull( Config{ 100 } ) );
+
+			// 읽는 스레드는 LocalReader를 가지며, 교체되지 않았다면 레퍼런스 카운트 변경 없이 가지고 있던 NotNull을 반환합니다.
+			WsyAtomicNotNullShared< Config >::LocalReader reader( config );
+			std::cout << "[E10 - 0] maxUser is " << reader.Get()().maxUser << std::endl;
+
+			// 교체는 새로운 버전을 만들어 통째로 바꾸며, 이전 버전을 읽던 곳은 그대로 사용합니다.
+			WsyNotNullShared< Config > oldConfig = reader.Get();
+			config.Update( []( const Config& current ) { return WsyNotNullShared< Config >::MakeNotNull( Config{ current.maxUser * 2 } ); } );
+
+			std::cout << "[E10 - 1] maxUser is " << reader.Get()().maxUser << ", old maxUser is " << oldConfig().maxUser << std::endl;
+		}
+
+		/// E11. 스레드 간에 소유권 옮기기 ( NotNullQueue )
+		{
+			// 용량은 2의 거듭제곱으로 올림됩니다.
+			WsyNotNullQueueUnique< int > jobQueue( 64 );
+
+			// 가득 찬 경우 false를 반환하며, 이 때 job은 옮겨지지 않습니다.
+			auto job = WsyNotNullUnique< int >::MakeNotNull( 1 );
+			const bool isPushed = jobQueue.TryPush( std::move( job ) );
+
+			// 여러 요소는 CAS 한 번으로 넣고 꺼낼 수 있습니다.
+			std::vector< WsyNotNullUnique< int > > jobs;
+			jobs.push_back( WsyNotNullUnique< int >::MakeNotNull( 2 ) );
+			jobs.push_back( WsyNotNullUnique< int >::MakeNotNull( 3 ) );
+
+			const std::size_t pushedCount = jobQueue.TryPushBatch( jobs.begin(), jobs.end() );
+			jobs.erase( jobs.begin(), jobs.begin() + pushedCount );
+
+			std::cout << "[E11 - 0] isPushed is " << isPushed << ", pushedCount is " << pushedCount << ", size is " << jobQueue.GetApproxSize() << std::endl;
+
+			// TryPop은 비어있을 수 있으므로 Nullable을 반환합니다.
+			[ & ]()
+			{
+				auto nullable = jobQueue.TryPop();
+				EXPAND_TO_NOTNULL_MOVE( nullable, notnull, RETURN_VOID );
+
+				std::cout << "[E11 - 1] popped job is " << notnull << std::endl;
+			}();
+
+			// TryPopBatch로 꺼낸 요소들은 NotNull이므로, null 확인 없이 사용합니다.
+			// 컨테이너에 넣을 때는, 꺼내기 전에 reserve하므로 할당이 실패하더라도 요소를 잃어버리지 않습니다.
+			std::vector< WsyNotNullUnique< int > > poppedJobs;
+
+			// 빈 range를 넣거나 0개를 꺼내면, 아무것도 하지 않고 0을 반환합니다.
+			const std::size_t emptyPushedCount = jobQueue.TryPushBatch( jobs.end(), jobs.end() );
+			const std::size_t zeroPoppedCount  = jobQueue.TryPopBatch( poppedJobs, 0 );
+
+			std::cout << "[E11 - 2] emptyPushedCount is " << emptyPushedCount << ", zeroPoppedCount is " << zeroPoppedCount << ", size is " << jobQueue.GetApproxSize() << std::endl;
+
+			jobQueue.TryPopBatch( poppedJobs, 16 );
+
+			for ( const auto& poppedJob : poppedJobs )
+				std::cout << "[E11 - 3] popped job is " << poppedJob << std::endl;
+		}
+
+		/// E12. 다른 스레드가 Release하더라도, 확장한 동안 해제되지 않기 ( EpochPtr )
+		{
+			WsyNullableEpoch< int > shared = WsyNullableEpoch< int >::MakeNullable( elementValue0 );
+
+			[ & ]()
+			{
+				// 확장하는 동안 세대가 고정되므로, 이 스코프에서는 다른 스레드가 Release하더라도 notnull이 해제되지 않습니다.
+				EXPAND_TO_NOTNULL( shared, notnull, RETURN_VOID );
+
+				// 확장한 대상은 복사본이므로, 원본을 Release하면 원본은 null이 되고 해제는 미뤄집니다.
+				shared.Release();
+
+				std::cout << "[E12 - 0] notnull Value is " << notnull << ", retired count is " << WonSY::EpochDomain::GetInstance().GetRetiredCount() << std::endl;
+			}();
+
+			// Release()된 포인터는 Reclaim()에서 해제됩니다. ( 혹은 EpochReclaimer로 백그라운드에서 주기적으로 호출합니다. )
+			std::size_t reclaimedCount = 0;
+			for ( int count = 0; count < 3; ++count )
+				reclaimedCount += WonSY::EpochDomain::GetInstance().Reclaim();
+
+			std::cout << "[E12 - 1] reclaimed count is " << reclaimedCount << std::endl;
+		}
+
+		/// E13. 디스크에서 로드하는 Acquire를 코루틴으로 기다리기 ( AsyncNotNullCache, NotNullTask )
+		{
+			const std::filesystem::path assetPath = std::filesystem::temp_directory_path() / "WonSY_Example_E13.txt";
+			std::ofstream( assetPath ) << "Hello NotNull";
+
+			// loader는 풀의 스레드에서 실행되며, 같은 key의 동시 Acquire는 하나의 로드를 공유합니다.
+			WonSY::ThreadPoolExecutor executor( 2 );
+			WsyAsyncNotNullCache< std::filesystem::path, std::string > assetCache( executor, []( const std::filesystem::path& path )
+				{
+					std::ifstream     file( path );
+					std::stringstream stream;
+					stream << file.rdbuf();
+
+					return WsyNotNullShared< std::string >::MakeNotNull( stream.str() );
+				} );
+
+			// 코루틴의 인자는 co_await 이후에도 유효해야 하므로, assetCache는 SyncWait이 끝날 때까지 유지됩니다.
+			const auto LoadAsset = []( WsyAsyncNotNullCache< std::filesystem::path, std::string >& cache, std::filesystem::path path ) -> WsyNotNullTaskShared< std::string >
+				{
+					// Get은 로드를 기다리지 않으며, 아직 로드되지 않았으므로 null입니다.
+					WsyNullableShared< std::string > cached = co_await cache.Get( path );
+					std::cout << "[E13 - 0] cached is " << static_cast< bool >( cached ) << std::endl;
+
+					// 로드하는 동안 이 코루틴만 멈추며, 로드된 요소는 NotNull로 반환됩니다.
+					co_return co_await cache.Acquire( path );
+				};
+
+			WsyNotNullShared< std::string > asset = WonSY::SyncWait( LoadAsset( assetCache, assetPath ) );
+			std::cout << "[E13 - 1] asset is " << asset() << ", cached is " << static_cast< bool >( assetCache.TryGet( assetPath ) ) << std::endl;
+
+			std::filesystem::remove( assetPath );
+		}
+
+		/// E14. Nullable의 컨테이너를 루프마다 확장하지 않고 순회하기 ( views::expand_not_null )
+		{
+			struct Unit
+			{
+				int hp;
+			};
+
+			std::vector< WsyNullableShared< Unit > > units;
+			units.push_back( WsyNullableShared< Unit >::MakeNullable( Unit{ 100 } ) );
+			units.push_back( nullptr );
+			units.push_back( WsyNullableShared< Unit >::MakeNullable( Unit{ 0 } ) );
+
+			// null은 건너뛰며, 요소는 빌려온 NotNullRef< Unit >이므로 임시 저장소와 레퍼런스 카운트 변화가 없습니다.
+			// 표준 view와 이어서 사용할 수 있습니다.
+			for ( const auto unit : units | WonSY::views::expand_not_null | std::views::filter( []( const WsyNotNullRef< Unit > unit ) { return unit().hp > 0; } ) )
+			{
+				unit().hp -= 10;
+				std::cout << "[E14 - 0] unit hp is " << unit().hp << std::endl;
+			}
+		}
+
+		/// E15. 대부분이 null인 Nullable< T* > 배열을 분기 없이 스캔하기 ( NullableScan )
+		{
+			int elements[ 4 ] = { 10, 20, 30, 40 };
+
+			std::vector< WsyNullableRaw< int > > nullables( 8 );
+			nullables[ 1 ] = &elements[ 0 ];
+			nullables[ 6 ] = &elements[ 3 ];
+
+			// 포인터들을 SIMD( AVX2, SSE2 )로 한번에 비교하여 마스크를 만든 후, 유효한 요소의 인덱스만 모읍니다.
+			std::vector< std::uint32_t > indices( nullables.size() );
+			const std::size_t count = WonSY::CompactNotNullIndices( nullables, std::span< std::uint32_t >( indices ) );
+
+			std::cout << "[E15 - 0] count is " << WonSY::CountNotNull( nullables ) << ", first index is " << indices[ 0 ] << ", path is " << static_cast< int >( WonSY::GetNullableScanPath() ) << std::endl;
+
+			// NotNull< T* >로 모으면, 이후의 처리는 null 확인 없이 진행합니다.
+			std::vector< WsyNotNullRaw< int > > notnulls;
+			notnulls.reserve( count );
+			WonSY::CompactNotNull( nullables, std::back_inserter( notnulls ) );
+
+			for ( const auto& notnull : notnulls )
+				std::cout << "[E15 - 1] notnull Value is " << notnull << std::endl;
+		}
 	}
 
 	// 감사합니다.
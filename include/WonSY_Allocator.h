@@ -0,0 +1,152 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_ALLOCATOR
+#define WONSY_ALLOCATOR
+
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+
+namespace WonSY
+{
+	/*
+		NotNull, Nullable의 Allocator 기반 FactoryFunc( AllocateNotNull, AllocateNullable )에서 사용하는 도구들입니다.
+
+		표준 Allocator( std::allocator_traits를 만족하는 타입 )나 std::pmr::memory_resource*를 받아,
+		전역 힙 대신 해당 Allocator( 예를 들어 프레임 단위로 한번에 해제되는 monotonic arena )에서 메모리를 할당합니다.
+
+		[ Version ]
+		// 0.1
+			- Allocator로 ElementType을 할당, 해제하는 함수와 unique_ptr을 위한 AllocatorDeleter를 추가하였습니다.
+			  ( 현재는 pointer 타입이 T*인 Allocator만 지원합니다. )
+	*/
+
+	template < typename Alloc >
+	concept AllocatorType = requires( Alloc& alloc, std::size_t count )
+	{
+		typename Alloc::value_type;
+		{ alloc.allocate( count ) };
+	};
+
+	template < typename T, AllocatorType Alloc >
+	using ReboundAllocator = typename std::allocator_traits< Alloc >::template rebind_alloc< T >;
+
+	// alloc으로 T 하나를 할당하고 생성합니다. 생성 중 예외가 발생하면, 할당한 메모리는 돌려줍니다.
+	template < typename T, AllocatorType Alloc, typename... Args >
+	[[nodiscard]] T* AllocateElement( const Alloc& alloc, Args&&... args )
+	{
+		using Rebound = ReboundAllocator< T, Alloc >;
+		using Traits  = std::allocator_traits< Rebound >;
+		static_assert( std::is_same_v< typename Traits::pointer, T* >, "Only allocators whose pointer type is T* are supported." );
+
+		Rebound rebound( alloc );
+		T* const ptr = Traits::allocate( rebound, 1 );
+
+		try
+		{
+			Traits::construct( rebound, ptr, std::forward< Args >( args )... );
+		}
+		catch ( ... )
+		{
+			Traits::deallocate( rebound, ptr, 1 );
+			throw;
+		}
+
+		return ptr;
+	}
+
+	// AllocateElement로 할당된 ptr을 소멸시키고, alloc으로 메모리를 돌려줍니다.
+	template < typename T, AllocatorType Alloc >
+	void DeallocateElement( const Alloc& alloc, T* const ptr ) noexcept
+	{
+		using Rebound = ReboundAllocator< T, Alloc >;
+		using Traits  = std::allocator_traits< Rebound >;
+
+		if ( !ptr )
+			return;
+
+		Rebound rebound( alloc );
+		Traits::destroy( rebound, ptr );
+		Traits::deallocate( rebound, ptr, 1 );
+	}
+
+	// unique_ptr< T, AllocatorDeleter< T, Alloc > >로, 소멸 시 delete 대신 Allocator로 메모리를 돌려줍니다.
+	template < typename T, AllocatorType Alloc >
+	class AllocatorDeleter
+	{
+	public:
+		using ReboundType = ReboundAllocator< T, Alloc >;
+
+	private:
+		[[no_unique_address]] ReboundType m_alloc;
+
+	public:
+		AllocatorDeleter() = default;
+
+		AllocatorDeleter( const AllocatorDeleter& ) noexcept = default;
+
+		// std::pmr::polymorphic_allocator처럼 할당 연산자가 없는 Allocator도 있어, 다시 생성하는 방식으로 처리합니다.
+		// ( unique_ptr의 이동 할당, swap에서 필요합니다. )
+		AllocatorDeleter& operator=( const AllocatorDeleter& rhs ) noexcept
+		{
+			if constexpr ( std::is_copy_assignable_v< ReboundType > )
+			{
+				m_alloc = rhs.m_alloc;
+			}
+			else if ( this != &rhs )
+			{
+				std::destroy_at( std::addressof( m_alloc ) );
+				std::construct_at( std::addressof( m_alloc ), rhs.m_alloc );
+			}
+
+			return *this;
+		}
+
+		// Allocator는 다른 value_type의 Allocator로부터 생성( rebind )될 수 있습니다.
+		template < typename OtherAlloc >
+			requires ( !std::is_same_v< OtherAlloc, AllocatorDeleter > && std::is_constructible_v< ReboundType, const OtherAlloc& > )
+		explicit AllocatorDeleter( const OtherAlloc& alloc ) noexcept
+			: m_alloc( alloc )
+		{
+		}
+
+		void operator()( T* const ptr ) const noexcept
+		{
+			DeallocateElement( m_alloc, ptr );
+		}
+
+		const ReboundType& GetAllocator() const noexcept
+		{
+			return m_alloc;
+		}
+	};
+
+	template < typename T >
+	class IsAllocatorDeleter
+		: public std::false_type
+	{
+	};
+
+	template < typename T, typename Alloc >
+	class IsAllocatorDeleter< AllocatorDeleter< T, Alloc > >
+		: public std::true_type
+	{
+	};
+}
+
+template< class T, class Alloc >
+using WsyUniquePtrAlloc = std::unique_ptr< T, WonSY::AllocatorDeleter< T, Alloc > >;
+
+template< class T >
+using WsyUniquePtrPmr = std::unique_ptr< T, WonSY::AllocatorDeleter< T, std::pmr::polymorphic_allocator< T > > >;
+
+#endif
@@ -0,0 +1,323 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_ASYNC_NOTNULL_CACHE
+#define WONSY_ASYNC_NOTNULL_CACHE
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_Nullable.h"
+#include "WonSY_NotNullTask.h"
+
+
+namespace WonSY
+{
+	/*
+		[예제C]의 Get, Acquire 패턴에서, 생성( 디스크 로드 등 )을 ThreadPoolExecutor에서 처리하고 코루틴으로 기다리는 AsyncNotNullCache입니다.
+
+		NotNullCache( WonSY_NotNullCache.h )의 Acquire는 생성이 끝날 때까지 호출한 스레드를 멈춥니다.
+		AsyncNotNullCache의 Acquire는 co_await하는 awaitable을 반환하며, 생성을 기다리는 동안 코루틴만 멈추고 스레드는 다른 작업을 처리합니다.
+
+			- co_await Acquire( key ) : 있으면 바로, 없으면 loader( key )를 ThreadPoolExecutor에서 실행한 후 NotNull< shared_ptr< T > >을 반환합니다.
+			- 같은 key를 동시에 Acquire하면, 진행 중인 하나의 로드를 공유하며 로드가 끝나면 기다리던 코루틴들이 모두 재개됩니다.
+			- co_await Get( key )     : 로드를 기다리지 않고 바로 반환합니다. 없거나 로드 중이라면 null입니다. ( Nullable< shared_ptr< T > > )
+			- loader에서 예외가 발생하면, 기다리던 코루틴들에 모두 전달되며 캐시에 남지 않으므로 다음 Acquire에서 다시 로드합니다.
+			- 재개된 코루틴은 ThreadPoolExecutor의 스레드에서 이어서 실행됩니다.
+
+		주의 해야할 것은,
+			- loader는 ThreadPoolExecutor의 스레드에서 실행되며, lock 밖에서 호출됩니다. ( 여러 key의 로드가 동시에 실행될 수 있습니다. )
+			- Acquire, Get이 반환한 awaitable은 바로 co_await해야 합니다. ( AsyncNotNullCache보다 먼저 소멸되어야 합니다. )
+			- 로드 중인 key를 Erase하면, 기다리던 코루틴들은 캐시에 남지 않는 요소를 받습니다.
+			- ThreadPoolExecutor는 AsyncNotNullCache보다 늦게 소멸되어야 하며, 소멸되기 전에 모든 Acquire가 완료되어야 합니다.
+
+		[ Version ]
+		// 0.1
+			- 오래 걸리는 생성을 비동기로 처리하고 같은 key의 로드를 합치기 위해, 코루틴 기반의 AsyncNotNullCache를 추가하였습니다.
+
+		// 0.2
+			- 로드를 ThreadPoolExecutor에 넘기지 못한 경우, 기다리던 코루틴들이 재개되지 않고 캐시에 로드 중인 채로 남던 문제를 수정하였습니다.
+	*/
+
+	template< typename Key, typename T, typename Hash = std::hash< Key > >
+	class AsyncNotNullCache
+	{
+	public:
+		using KeyType      = Key;
+		using ElementType  = T;
+		using Type         = std::shared_ptr< ElementType >;
+		using NotNullType  = NotNull< Type >;
+		using NullableType = Nullable< Type >;
+		using LoaderType   = std::function< NotNullType( const KeyType& ) >;
+
+	private:
+		// key별 로드입니다. 로드가 끝나면( isDone ) notNull과 exception 중 하나가 설정되며, 더 이상 바뀌지 않습니다.
+		class Entry
+		{
+		public:
+			bool                                   isDone = false;
+			std::optional< NotNullType >           notNull;
+			std::exception_ptr                     exception;
+			std::vector< std::coroutine_handle<> > waiters;
+		};
+
+		using EntryPtr = std::shared_ptr< Entry >;
+
+		ThreadPoolExecutor&                           m_executor;
+		LoaderType                                    m_loader;
+		mutable std::shared_mutex                     m_mutex;
+		std::unordered_map< KeyType, EntryPtr, Hash > m_entries;
+
+		// 풀의 스레드에서 로드한 후, 기다리던 코루틴들을 재개합니다.
+		void _Load( const KeyType& key, EntryPtr entry )
+		{
+			std::optional< NotNullType > notNull;
+			std::exception_ptr           exception;
+
+			try
+			{
+				notNull.emplace( m_loader( key ) );
+			}
+			catch ( ... )
+			{
+				exception = std::current_exception();
+			}
+
+			std::vector< std::coroutine_handle<> > waiters;
+			{
+				std::unique_lock lock( m_mutex );
+
+				entry->notNull   = std::move( notNull );
+				entry->exception = std::move( exception );
+				entry->isDone    = true;
+				waiters          = std::move( entry->waiters );
+
+				// 실패한 로드는 캐시에 남기지 않습니다. ( 그 사이 Erase 후 다시 추가된 로드는 유지합니다. )
+				if ( entry->exception )
+				{
+					if ( const auto iter = m_entries.find( key ); iter != m_entries.end() && iter->second == entry )
+						m_entries.erase( iter );
+				}
+			}
+
+			// 재개된 코루틴이 마지막으로 Entry( 와 exception )를 해제하도록, 재개하기 전에 놓아줍니다.
+			entry.reset();
+
+			// 로드한 스레드에서 모두 이어서 실행하지 않도록, 각각 풀에 넘깁니다.
+			for ( const std::coroutine_handle<> waiter : waiters )
+				m_executor.Post( [ waiter ]() { waiter.resume(); } );
+		}
+
+		// 로드를 풀에 넘기지 못한 경우, 실패한 로드로 처리하여 기다리던 다른 코루틴들에 exception을 전달합니다.
+		void _FailToPost( const KeyType& key, EntryPtr entry, const std::coroutine_handle<> loader, std::exception_ptr exception )
+		{
+			std::vector< std::coroutine_handle<> > waiters;
+			{
+				std::unique_lock lock( m_mutex );
+
+				entry->exception = std::move( exception );
+				entry->isDone    = true;
+				waiters          = std::move( entry->waiters );
+
+				if ( const auto iter = m_entries.find( key ); iter != m_entries.end() && iter->second == entry )
+					m_entries.erase( iter );
+			}
+
+			entry.reset();
+
+			// 풀에 넘길 수 없으므로, 이 스레드에서 바로 재개합니다. ( 로드를 요청한 코루틴은 예외를 다시 던져 재개합니다. )
+			for ( const std::coroutine_handle<> waiter : waiters )
+			{
+				if ( waiter != loader )
+					waiter.resume();
+			}
+		}
+
+		class AcquireAwaiter
+		{
+		private:
+			AsyncNotNullCache* m_cache;
+			KeyType            m_key;
+			EntryPtr           m_entry;
+			bool               m_isLoader = false;
+
+		public:
+			AcquireAwaiter( AsyncNotNullCache& cache, KeyType key )
+				: m_cache{ &cache          }
+				, m_key  ( std::move( key ) )
+			{
+			}
+
+			// 이미 로드된 요소는, 멈추지 않고 바로 반환합니다.
+			bool await_ready()
+			{
+				{
+					std::shared_lock lock( m_cache->m_mutex );
+					if ( const auto iter = m_cache->m_entries.find( m_key ); iter != m_cache->m_entries.end() )
+					{
+						m_entry = iter->second;
+						return m_entry->isDone;
+					}
+				}
+
+				std::unique_lock lock( m_cache->m_mutex );
+				auto [ iter, isInserted ] = m_cache->m_entries.try_emplace( m_key, nullptr );
+				if ( isInserted )
+				{
+					try
+					{
+						iter->second = std::make_shared< Entry >();
+					}
+					catch ( ... )
+					{
+						m_cache->m_entries.erase( iter );
+						throw;
+					}
+
+					m_isLoader = true;
+				}
+
+				m_entry = iter->second;
+				return m_entry->isDone;
+			}
+
+			// 로드가 끝나지 않았다면 기다리는 코루틴으로 등록하며, 처음 요청한 코루틴이 로드를 풀에 넘깁니다.
+			bool await_suspend( const std::coroutine_handle<> handle )
+			{
+				// 등록한 이후의 실패를 줄이기 위해, 로드 작업을 먼저 만듭니다.
+				std::optional< ThreadPoolExecutor::JobType > job;
+				if ( m_isLoader )
+					job.emplace( [ cache = m_cache, key = m_key, entry = m_entry ]() mutable { cache->_Load( key, std::move( entry ) ); } );
+
+				{
+					std::unique_lock lock( m_cache->m_mutex );
+					if ( m_entry->isDone )
+						return false;
+
+					m_entry->waiters.push_back( handle );
+				}
+
+				if ( job )
+				{
+					try
+					{
+						m_cache->m_executor.Post( std::move( *job ) );
+					}
+					catch ( ... )
+					{
+						// 그대로 두면, 등록된 코루틴들이 완료되지 않는 로드를 계속 기다리게 됩니다.
+						m_cache->_FailToPost( m_key, m_entry, handle, std::current_exception() );
+						throw;
+					}
+				}
+
+				return true;
+			}
+
+			NotNullType await_resume() const
+			{
+				if ( m_entry->exception )
+					std::rethrow_exception( m_entry->exception );
+
+				return *m_entry->notNull;
+			}
+		};
+
+		class GetAwaiter
+		{
+		private:
+			NullableType m_nullable;
+
+		public:
+			explicit GetAwaiter( NullableType nullable ) noexcept
+				: m_nullable( std::move( nullable ) )
+			{
+			}
+
+			bool await_ready() const noexcept
+			{
+				return true;
+			}
+
+			void await_suspend( const std::coroutine_handle<> ) const noexcept
+			{
+			}
+
+			NullableType await_resume() noexcept
+			{
+				return std::move( m_nullable );
+			}
+		};
+
+	public:
+		// loader( key )는 executor의 스레드에서 실행됩니다.
+		template< typename Loader >
+			requires std::is_convertible_v< std::invoke_result_t< Loader&, const KeyType& >, NotNullType >
+		AsyncNotNullCache( ThreadPoolExecutor& executor, Loader&& loader )
+			: m_executor{ executor                         }
+			, m_loader  ( std::forward< Loader >( loader ) )
+		{
+		}
+
+		AsyncNotNullCache( const AsyncNotNullCache& )            = delete;
+		AsyncNotNullCache& operator=( const AsyncNotNullCache& ) = delete;
+
+		// co_await하면, key의 요소를( 없다면 로드한 후 ) 반환합니다.
+		[[nodiscard]] AcquireAwaiter Acquire( KeyType key )
+		{
+			return AcquireAwaiter( *this, std::move( key ) );
+		}
+
+		// co_await하면, 로드를 기다리지 않고 key의 요소 혹은 null을 반환합니다.
+		[[nodiscard]] GetAwaiter Get( const KeyType& key ) const
+		{
+			return GetAwaiter( TryGet( key ) );
+		}
+
+		// 코루틴이 아닌 곳에서 사용하는 Get입니다.
+		[[nodiscard]] NullableType TryGet( const KeyType& key ) const
+		{
+			std::shared_lock lock( m_mutex );
+			if ( const auto iter = m_entries.find( key ); iter != m_entries.end() && iter->second->notNull )
+				return NullableType( *iter->second->notNull );
+
+			return nullptr;
+		}
+
+		// 로드 중인 key는 기다리던 코루틴들이 요소를 받은 후, 캐시에 남지 않습니다.
+		bool Erase( const KeyType& key )
+		{
+			std::unique_lock lock( m_mutex );
+			return m_entries.erase( key ) != 0;
+		}
+
+		[[nodiscard]] std::size_t size() const
+		{
+			std::shared_lock lock( m_mutex );
+			return m_entries.size();
+		}
+	};
+}
+
+template< typename Key, typename T, typename Hash = std::hash< Key > >
+using WsyAsyncNotNullCache = WonSY::AsyncNotNullCache< Key, T, Hash >;
+
+#endif
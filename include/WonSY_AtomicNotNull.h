@@ -0,0 +1,227 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_ATOMIC_NOTNULL
+#define WONSY_ATOMIC_NOTNULL
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		여러 스레드가 읽고, 드물게 교체되는 데이터( 설정, 라우팅 테이블 등 )를 위한 AtomicNotNull, AtomicNullable입니다. ( RCU 방식 )
+
+		NotNull< shared_ptr< T > >을 다른 스레드가 읽는 중에 할당하는 것은 data race이므로, 보통 mutex로 보호하게 되며 모든 읽기가 mutex에서 경합합니다.
+		AtomicNotNull은 std::atomic< shared_ptr< T > >에 담으며, 교체 시 새로운 버전을 만들어 통째로 바꿉니다. ( 기존 버전을 읽던 스레드는 그대로 사용합니다. )
+
+			- Load()        : 현재 버전을 NotNull( AtomicNullable은 Nullable )로 반환합니다. ( 레퍼런스 카운트가 증가합니다. )
+			- Store()       : 새로운 버전으로 교체합니다.
+			- Exchange()    : 새로운 버전으로 교체하고, 이전 버전을 반환합니다.
+			- Update( func ): ( AtomicNotNull만 ) func( const ElementType& )로 만든 새로운 버전으로 교체합니다. 다른 스레드가 먼저 교체했다면, 그 버전으로 다시 func을 호출합니다.
+			                  AtomicNullable은 현재 버전이 null일 수 있어 제공하지 않으며, Load()로 확인한 후 Store(), Exchange()를 사용합니다.
+			- LocalReader   : 스레드( 혹은 작업 단위 )별로 가지는 읽기 캐시입니다.
+			                  교체 시마다 증가하는 버전 번호만 확인하여, 바뀌지 않았다면 가지고 있던 NotNull을 그대로 반환합니다.
+			                  따라서 교체되지 않는 동안의 읽기는 lock, 레퍼런스 카운트 변경 없이 원자적 읽기 한 번으로 처리됩니다. ( 지연된 레퍼런스 카운트 )
+
+		주의 해야할 것은,
+			- shared_ptr만 지원합니다.
+			- LocalReader는 한 스레드에서만 사용해야 하며, 가지고 있는 동안 이전 버전이 해제되지 않습니다. ( 다음 Get에서 교체됩니다. )
+			- LocalReader::Get()이 반환한 레퍼런스는, 같은 LocalReader의 다음 Get 호출 전까지만 유효합니다.
+			- std::atomic< shared_ptr< T > >은 구현에 따라 lock-free가 아닐 수 있습니다. ( 내부적으로 짧은 spin lock을 사용합니다. )
+
+		[ Version ]
+		// 0.1
+			- mutex로 보호되던 읽기 위주의 NotNull< shared_ptr< T > >을 대체하기 위해, AtomicNotNull, AtomicNullable을 추가하였습니다.
+	*/
+
+	// AtomicNotNull, AtomicNullable이 공유하는 저장소입니다.
+	template< SharedPtrType _Type >
+	class AtomicSharedStorage
+	{
+	public:
+		using Type        = _Type;
+		using ElementType = WsyElementType< _Type >::Type;
+
+	protected:
+		std::atomic< Type >          m_data;
+		std::atomic< std::uint64_t > m_version{ 1 };
+
+		explicit AtomicSharedStorage( Type&& data ) noexcept
+			: m_data( std::move( data ) )
+		{
+		}
+
+		[[nodiscard]] Type _Load() const noexcept
+		{
+			return m_data.load( std::memory_order_acquire );
+		}
+
+		// 데이터를 교체한 후 버전을 증가시키므로, 버전을 읽은 이후의 _Load()는 적어도 그 버전 이후의 데이터를 반환합니다.
+		void _Store( Type&& data ) noexcept
+		{
+			m_data.store( std::move( data ), std::memory_order_release );
+			m_version.fetch_add( 1, std::memory_order_release );
+		}
+
+		[[nodiscard]] Type _Exchange( Type&& data ) noexcept
+		{
+			Type oldData = m_data.exchange( std::move( data ), std::memory_order_acq_rel );
+			m_version.fetch_add( 1, std::memory_order_release );
+
+			return oldData;
+		}
+
+	public:
+		AtomicSharedStorage( const AtomicSharedStorage& )            = delete;
+		AtomicSharedStorage& operator=( const AtomicSharedStorage& ) = delete;
+
+		// Store, Exchange, Update마다 증가합니다.
+		[[nodiscard]] std::uint64_t GetVersion() const noexcept
+		{
+			return m_version.load( std::memory_order_acquire );
+		}
+	};
+
+	template< typename Source, typename ValueType >
+	class AtomicLocalReader
+	{
+	private:
+		const Source* m_source;
+		std::uint64_t m_version;
+		ValueType     m_value;
+
+	public:
+		explicit AtomicLocalReader( const Source& source )
+			: m_source { &source              }
+			, m_version{ source.GetVersion() }
+			, m_value  ( source.Load()        )
+		{
+		}
+
+		// 교체되지 않았다면, 가지고 있던 값을 그대로 반환합니다.
+		[[nodiscard]] const ValueType& Get()
+		{
+			if ( const std::uint64_t version = m_source->GetVersion(); version != m_version ) [[unlikely]]
+			{
+				m_value   = m_source->Load();
+				m_version = version;
+			}
+
+			return m_value;
+		}
+
+		operator const ValueType&()
+		{
+			return Get();
+		}
+	};
+
+	template< SharedPtrType _Type >
+	class AtomicNotNull
+		: public AtomicSharedStorage< _Type >
+	{
+		using Base = AtomicSharedStorage< _Type >;
+
+	public:
+		using Type        = _Type;
+		using ElementType = WsyElementType< _Type >::Type;
+		using NotNullType = NotNull< Type >;
+		using LocalReader = AtomicLocalReader< AtomicNotNull, NotNullType >;
+
+		explicit AtomicNotNull( NotNullType notNull ) noexcept
+			: Base( std::move( notNull ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
+		{
+		}
+
+		[[nodiscard]] NotNullType Load() const noexcept
+		{
+			return NotNullType::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( this->_Load() );
+		}
+
+		void Store( NotNullType notNull ) noexcept
+		{
+			this->_Store( std::move( notNull ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() );
+		}
+
+		[[nodiscard]] NotNullType Exchange( NotNullType notNull ) noexcept
+		{
+			return NotNullType::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( this->_Exchange( std::move( notNull ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() ) );
+		}
+
+		// func( const ElementType& )가 반환한 NotNull로 교체합니다.
+		template< typename Func >
+			requires std::is_convertible_v< std::invoke_result_t< Func&, const ElementType& >, NotNullType >
+		void Update( Func&& func )
+		{
+			Type expected = this->_Load();
+			Type desired  = NotNullType( func( std::as_const( *expected ) ) ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD();
+
+			// 실패 시 expected는 다른 스레드가 교체한 버전으로 바뀝니다.
+			while ( !this->m_data.compare_exchange_weak( expected, desired, std::memory_order_acq_rel, std::memory_order_acquire ) )
+				desired = NotNullType( func( std::as_const( *expected ) ) ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD();
+
+			this->m_version.fetch_add( 1, std::memory_order_release );
+		}
+	};
+
+	template< SharedPtrType _Type >
+	class AtomicNullable
+		: public AtomicSharedStorage< _Type >
+	{
+		using Base = AtomicSharedStorage< _Type >;
+
+	public:
+		using Type         = _Type;
+		using ElementType  = WsyElementType< _Type >::Type;
+		using NullableType = Nullable< Type >;
+		using LocalReader  = AtomicLocalReader< AtomicNullable, NullableType >;
+
+		AtomicNullable() noexcept
+			: Base( Type() )
+		{
+		}
+
+		explicit AtomicNullable( NullableType nullable ) noexcept
+			: Base( std::move( nullable ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
+		{
+		}
+
+		[[nodiscard]] NullableType Load() const noexcept
+		{
+			return NullableType( this->_Load() );
+		}
+
+		void Store( NullableType nullable ) noexcept
+		{
+			this->_Store( std::move( nullable ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() );
+		}
+
+		[[nodiscard]] NullableType Exchange( NullableType nullable ) noexcept
+		{
+			return NullableType( this->_Exchange( std::move( nullable ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() ) );
+		}
+	};
+}
+
+template< typename T >
+using WsyAtomicNotNullShared = WonSY::AtomicNotNull< WsySharedPtr< T > >;
+
+template< typename T >
+using WsyAtomicNullableShared = WonSY::AtomicNullable< WsySharedPtr< T > >;
+
+#endif
@@ -0,0 +1,413 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_EPOCH_PTR
+#define WONSY_EPOCH_PTR
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull< EpochPtr< T > >, Nullable< EpochPtr< T > >로 사용하는, 세대( epoch ) 기반으로 해제를 미루는 RawPointer입니다.
+
+		Nullable< T* >의 Release()는 바로 delete하므로, 다른 스레드에서 EXPAND_TO_NOTNULL로 확장한 NotNull이 댕글링될 수 있고( [예제A1] ),
+		delete의 비용도 Release()를 호출한 스레드가 부담합니다.
+		Nullable< EpochPtr< T > >의 Release()는 포인터를 null로 바꾼 후 EpochDomain에 넘기며( Retire ), 실제 해제는 나중에 한번에 처리됩니다.
+
+			- EXPAND_TO_NOTNULL 계열 매크로는 확장하기 전에 현재 세대를 고정( Pin )하며, 확장한 스코프가 끝날 때 해제합니다. ( Nullable의 PinnedNullable )
+			- EpochDomain::Reclaim()은 고정된 스레드들이 모두 현재 세대에 도달했다면 세대를 증가시키고, 두 세대 이전에 Retire된 포인터들을 해제합니다.
+			  프레임의 끝 등 원하는 시점에 호출하거나, EpochReclaimer로 백그라운드 스레드에서 주기적으로 호출합니다.
+			- 읽기는 레퍼런스 카운트 없이, 스레드별 세대 값을 쓰는 것으로 처리됩니다. ( 다른 스레드와 경합하지 않습니다. )
+			- 확장하지 않고 여러 번 접근하는 구간은, EpochDomain::GetInstance().Pin()의 EpochGuard로 직접 고정할 수 있습니다.
+			- EpochPtr은 std::atomic< T* >이므로, 같은 Nullable< EpochPtr< T > >을 여러 스레드에서 읽고 Release()해도 data race가 발생하지 않습니다.
+
+		주의 해야할 것은,
+			- 확장한 NotNull< EpochPtr< T > >과 그 ElementType&는 확장한 스코프( 혹은 EpochGuard ) 안에서만 사용해야 합니다.
+			- 고정된 채로 오래 머무르는 스레드가 있으면, 그 동안 세대가 증가하지 않아 해제가 밀립니다.
+			- 소유권은 new로 생성된 포인터에 대해, 한 곳에서만 Release()해야 합니다. ( Nullable< T* >와 같습니다. )
+			- NotNull에는 Release가 없으므로, NotNull< EpochPtr< T > >은 MakeNotNull, EmplaceNotNull로 생성할 수 없습니다. ( MakeNullable로 생성한 후 확장합니다. )
+			- Nullable< T* >의 동작은 바뀌지 않으며, 지연된 해제가 필요한 경우 Nullable< EpochPtr< T > >을 사용합니다.
+
+		[ Version ]
+		// 0.1
+			- Release()된 RawPointer를 다른 스레드가 확장한 채로 사용하는 중에 해제하지 않도록, 세대 기반 지연 해제( EpochPtr, EpochDomain )를 추가하였습니다.
+	*/
+
+	class EpochDomain;
+
+	// 생성 시 현재 스레드의 세대를 고정하고, 소멸 시 해제합니다. ( 중첩될 수 있습니다. )
+	class [[nodiscard]] EpochGuard
+	{
+		friend class EpochDomain;
+
+	private:
+		EpochDomain* m_domain;
+
+		explicit EpochGuard( EpochDomain& domain ) noexcept
+			: m_domain{ &domain }
+		{
+		}
+
+	public:
+		EpochGuard( const EpochGuard& )            = delete;
+		EpochGuard& operator=( const EpochGuard& ) = delete;
+
+		inline ~EpochGuard();
+	};
+
+	class EpochDomain
+	{
+		friend class EpochGuard;
+
+	private:
+		// 스레드별 고정된 세대입니다. ( 0은 고정되지 않은 상태입니다. )
+		class ThreadRecord
+		{
+		public:
+			std::atomic< std::uint64_t > epoch   { 0     };
+			std::atomic< bool >          isActive{ false };
+			std::uint32_t                depth = 0;
+		};
+
+		class RetiredPointer
+		{
+		public:
+			using DeleteFunc = void ( * )( void* ) noexcept;
+
+			void*         ptr;
+			DeleteFunc    deleteFunc;
+			std::uint64_t epoch;
+		};
+
+		// 스레드가 종료되면, 다른 스레드가 재사용할 수 있도록 ThreadRecord를 돌려줍니다.
+		class ThreadRecordOwner
+		{
+		public:
+			ThreadRecord* record = nullptr;
+
+			~ThreadRecordOwner()
+			{
+				if ( record )
+				{
+					record->epoch.store( 0, std::memory_order_release );
+					record->isActive.store( false, std::memory_order_release );
+				}
+			}
+		};
+
+		std::atomic< std::uint64_t >                 m_globalEpoch{ 1 };
+
+		std::mutex                                   m_recordMutex;
+		std::vector< std::unique_ptr< ThreadRecord > > m_records;
+
+		std::mutex                                   m_retiredMutex;
+		std::vector< RetiredPointer >                m_retiredPointers;
+
+		[[nodiscard]] ThreadRecord& _GetThreadRecord()
+		{
+			thread_local ThreadRecordOwner s_owner;
+			if ( s_owner.record ) [[likely]]
+				return *s_owner.record;
+
+			std::lock_guard lock( m_recordMutex );
+			for ( const std::unique_ptr< ThreadRecord >& record : m_records )
+			{
+				if ( !record->isActive.load( std::memory_order_acquire ) )
+				{
+					record->isActive.store( true, std::memory_order_release );
+					return *( s_owner.record = record.get() );
+				}
+			}
+
+			m_records.push_back( std::make_unique< ThreadRecord >() );
+			m_records.back()->isActive.store( true, std::memory_order_release );
+			return *( s_owner.record = m_records.back().get() );
+		}
+
+		void _Unpin() noexcept
+		{
+			// Pin()에서 이미 얻었으므로, 할당이 일어나지 않습니다.
+			ThreadRecord& record = _GetThreadRecord();
+			if ( --record.depth == 0 )
+				record.epoch.store( 0, std::memory_order_release );
+		}
+
+		EpochDomain() = default;
+
+	public:
+		EpochDomain( const EpochDomain& )            = delete;
+		EpochDomain& operator=( const EpochDomain& ) = delete;
+
+		// 프로그램 종료 시, 남아있는 포인터들을 해제합니다.
+		~EpochDomain()
+		{
+			for ( const RetiredPointer& retired : m_retiredPointers )
+				retired.deleteFunc( retired.ptr );
+		}
+
+		// 스레드별 세대는 thread_local로 기록하므로, 하나의 EpochDomain만 사용합니다.
+		static EpochDomain& GetInstance() noexcept
+		{
+			static EpochDomain s_instance;
+			return s_instance;
+		}
+
+		// 현재 세대를 고정합니다. 반환된 EpochGuard가 소멸되기 전까지, 이후 Retire된 포인터들은 해제되지 않습니다.
+		[[nodiscard]] EpochGuard Pin()
+		{
+			ThreadRecord& record = _GetThreadRecord();
+			if ( record.depth++ == 0 )
+			{
+				// 세대를 기록한 사이에 세대가 증가했다면, 다시 기록합니다.
+				std::uint64_t epoch = m_globalEpoch.load( std::memory_order_seq_cst );
+				for ( ;; )
+				{
+					record.epoch.store( epoch, std::memory_order_seq_cst );
+
+					const std::uint64_t currentEpoch = m_globalEpoch.load( std::memory_order_seq_cst );
+					if ( currentEpoch == epoch )
+						break;
+
+					epoch = currentEpoch;
+				}
+			}
+
+			return EpochGuard( *this );
+		}
+
+		// 이미 null로 바뀌어 더 이상 새로 얻을 수 없는 ptr을, deleteFunc로 나중에 해제합니다.
+		void Retire( void* const ptr, const RetiredPointer::DeleteFunc deleteFunc )
+		{
+			const std::uint64_t epoch = m_globalEpoch.load( std::memory_order_seq_cst );
+
+			std::lock_guard lock( m_retiredMutex );
+			m_retiredPointers.push_back( RetiredPointer{ ptr, deleteFunc, epoch } );
+		}
+
+		template< typename T >
+		void Retire( T* const ptr )
+		{
+			Retire( const_cast< void* >( static_cast< const volatile void* >( ptr ) ), []( void* const p ) noexcept { delete static_cast< T* >( p ); } );
+		}
+
+		// 가능하다면 세대를 증가시키고, 해제해도 안전한 포인터들을 해제한 후 해제한 수를 반환합니다.
+		std::size_t Reclaim()
+		{
+			std::uint64_t epoch = m_globalEpoch.load( std::memory_order_seq_cst );
+
+			bool canAdvance = true;
+			{
+				std::lock_guard lock( m_recordMutex );
+				for ( const std::unique_ptr< ThreadRecord >& record : m_records )
+				{
+					const std::uint64_t recordEpoch = record->epoch.load( std::memory_order_seq_cst );
+					if ( recordEpoch != 0 && recordEpoch != epoch )
+					{
+						canAdvance = false;
+						break;
+					}
+				}
+			}
+
+			if ( canAdvance && m_globalEpoch.compare_exchange_strong( epoch, epoch + 1, std::memory_order_seq_cst ) )
+				++epoch;
+
+			// epoch - 2 이하의 세대에 Retire된 포인터는, 고정된 어떤 스레드도 가지고 있을 수 없습니다.
+			std::vector< RetiredPointer > reclaimablePointers;
+			{
+				std::lock_guard lock( m_retiredMutex );
+
+				auto iter = m_retiredPointers.begin();
+				for ( auto& retired : m_retiredPointers )
+				{
+					if ( retired.epoch + 2 <= epoch )
+						reclaimablePointers.push_back( retired );
+					else
+						*iter++ = retired;
+				}
+
+				m_retiredPointers.erase( iter, m_retiredPointers.end() );
+			}
+
+			// 해제는 lock 밖에서 처리합니다.
+			for ( const RetiredPointer& retired : reclaimablePointers )
+				retired.deleteFunc( retired.ptr );
+
+			return reclaimablePointers.size();
+		}
+
+		[[nodiscard]] std::size_t GetRetiredCount()
+		{
+			std::lock_guard lock( m_retiredMutex );
+			return m_retiredPointers.size();
+		}
+	};
+
+	EpochGuard::~EpochGuard()
+	{
+		m_domain->_Unpin();
+	}
+
+	// 백그라운드 스레드에서 interval마다 EpochDomain::Reclaim()을 호출합니다. 소멸 시 스레드를 종료합니다.
+	class EpochReclaimer
+	{
+	private:
+		std::mutex                  m_mutex;
+		std::condition_variable_any m_condition;
+		std::jthread                m_thread;
+
+	public:
+		explicit EpochReclaimer( const std::chrono::milliseconds interval )
+			: m_thread( [ this, interval ]( const std::stop_token stopToken )
+				{
+					while ( !stopToken.stop_requested() )
+					{
+						EpochDomain::GetInstance().Reclaim();
+
+						std::unique_lock lock( m_mutex );
+						m_condition.wait_for( lock, stopToken, interval, []() { return false; } );
+					}
+				} )
+		{
+		}
+
+		EpochReclaimer( const EpochReclaimer& )            = delete;
+		EpochReclaimer& operator=( const EpochReclaimer& ) = delete;
+	};
+
+	template < typename T >
+	class EpochPtr
+	{
+	public:
+		using element_type = T;
+
+	private:
+		std::atomic< T* > m_ptr;
+
+	public:
+		EpochPtr() noexcept
+			: m_ptr{ nullptr }
+		{
+		}
+
+		EpochPtr( std::nullptr_t ) noexcept
+			: m_ptr{ nullptr }
+		{
+		}
+
+		// new로 생성된 ptr의 소유권을 가집니다.
+		explicit EpochPtr( T* const ptr ) noexcept
+			: m_ptr{ ptr }
+		{
+		}
+
+		EpochPtr( const EpochPtr& rhs ) noexcept
+			: m_ptr{ rhs.get() }
+		{
+		}
+
+		EpochPtr& operator=( const EpochPtr& rhs ) noexcept
+		{
+			m_ptr.store( rhs.get(), std::memory_order_seq_cst );
+			return *this;
+		}
+
+		EpochPtr& operator=( std::nullptr_t ) noexcept
+		{
+			m_ptr.store( nullptr, std::memory_order_seq_cst );
+			return *this;
+		}
+
+		// Pin()한 이후의 읽기가 Retire 이전의 null 할당을 보도록, seq_cst로 읽습니다. ( x86에서는 일반 읽기와 같습니다. )
+		T* get() const noexcept
+		{
+			return m_ptr.load( std::memory_order_seq_cst );
+		}
+
+		T& operator*() const noexcept
+		{
+			return *get();
+		}
+
+		T* operator->() const noexcept
+		{
+			return get();
+		}
+
+		// null로 바꾼 후, 이전 포인터를 EpochDomain에 넘깁니다.
+		void Retire()
+		{
+			if ( T* const ptr = m_ptr.exchange( nullptr, std::memory_order_seq_cst ) )
+				EpochDomain::GetInstance().Retire( ptr );
+		}
+
+		bool operator==( std::nullptr_t ) const noexcept
+		{
+			return get() == nullptr;
+		}
+
+		explicit operator bool() const noexcept
+		{
+			return get() != nullptr;
+		}
+	};
+
+	template < typename T >
+	class PointerTraits< EpochPtr< T > >
+		: public PointerTraitsBase< EpochPtr< T >, T >
+	{
+	public:
+		// MakeNullable, EmplaceNullable에서 호출됩니다. ( Retire하지 않으면 해제되지 않으므로, NotNull의 MakeNotNull에서는 제한됩니다. )
+		template< typename... Args >
+			requires std::is_constructible_v< T, Args&&... >
+		static EpochPtr< T > Make( Args&&... args )
+		{
+			return EpochPtr< T >( new T( std::forward< Args >( args )... ) );
+		}
+
+		// Nullable::Release()에서 호출되며, delete 대신 Retire합니다.
+		static void Release( EpochPtr< T >& ptr )
+		{
+			ptr.Retire();
+		}
+
+		// 확장하는 동안 세대를 고정합니다.
+		static EpochGuard Pin()
+		{
+			return EpochDomain::GetInstance().Pin();
+		}
+	};
+}
+
+template< typename T >
+using WsyEpochPtr = WonSY::EpochPtr< T >;
+
+template< typename T >
+using WsyNotNullEpoch = WonSY::NotNull< WsyEpochPtr< T > >;
+
+template< typename T >
+using WsyNullableEpoch = WonSY::Nullable< WsyEpochPtr< T > >;
+
+#endif
@@ -0,0 +1,98 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_INLINE
+#define WONSY_INLINE
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "WonSY_TypeUtil.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull< Inline< T > >, Nullable< Inline< T > >로 사용하는, 힙 할당 없이 ElementType을 직접 들고 있는 타입입니다.
+
+		int와 같은 작은 값 타입을 NotNull로 다루기 위해, shared_ptr의 컨트롤 블록과 힙 할당, 포인터 추적을 하지 않도록 합니다.
+		NotNull, Nullable이 그대로 사용할 수 있도록, 포인터처럼 nullptr과의 비교, 할당, operator*()를 제공합니다.
+
+		주의 해야할 것은, 포인터가 아니라 "값"이기 때문에
+			- NotNull< Inline< T > >의 복사, Nullable로의 변환, EXPAND_TO_NOTNULL은 값을 복사합니다. ( 복사본의 수정은 원본에 반영되지 않습니다. )
+			- 원본을 수정해야 할 경우에는 EXPAND_TO_NOTNULL_REF로 빌려와서 사용해주세요.
+			- 포인터와 동일하게 const는 얕게( shallow ) 적용되므로, const NotNull에서도 ElementType&을 얻을 수 있습니다.
+
+		[ Version ]
+		// 0.1
+			- NotNull, Nullable이 힙 할당 없이 작은 ElementType을 담을 수 있도록 추가하였습니다.
+	*/
+
+	template < typename T >
+	class Inline
+	{
+	public:
+		using element_type = T;
+
+	private:
+		// 포인터와 동일하게 얕은 const를 제공하기 위해 mutable로 처리합니다.
+		mutable std::optional< T > m_value;
+
+	public:
+		Inline() noexcept = default;
+
+		Inline( std::nullptr_t ) noexcept
+			: m_value{ std::nullopt }
+		{
+		}
+
+		template< typename... Args >
+		explicit Inline( std::in_place_t, Args&&... args )
+			: m_value{ std::in_place, std::forward< Args >( args )... }
+		{
+		}
+
+		Inline& operator=( std::nullptr_t ) noexcept
+		{
+			m_value.reset();
+			return *this;
+		}
+
+		// 복사, 이동이 불가능한 T도 제자리에서 생성할 수 있도록 합니다.
+		template< typename... Args >
+		T& Emplace( Args&&... args )
+		{
+			return m_value.emplace( std::forward< Args >( args )... );
+		}
+
+		T& operator*() const noexcept
+		{
+			return *m_value;
+		}
+
+		T* operator->() const noexcept
+		{
+			return std::addressof( *m_value );
+		}
+
+		bool operator==( std::nullptr_t ) const noexcept
+		{
+			return !m_value.has_value();
+		}
+
+		explicit operator bool() const noexcept
+		{
+			return m_value.has_value();
+		}
+	};
+}
+
+#endif
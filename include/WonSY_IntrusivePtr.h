@@ -0,0 +1,204 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_INTRUSIVE_PTR
+#define WONSY_INTRUSIVE_PTR
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "WonSY_TypeUtil.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull< IntrusivePtr< T > >, Nullable< IntrusivePtr< T > >로 사용하는, 레퍼런스 카운트를 개체 내부에 두는 스마트 포인터입니다.
+
+		shared_ptr은 ElementType*와 컨트롤 블록*를 함께 들고 있어 16바이트이며, 역참조와 레퍼런스 카운트가 서로 다른 캐시라인을 건드릴 수 있습니다.
+		IntrusivePtr은 ElementType*만 들고 있어 포인터 크기( 8바이트 )이며, 레퍼런스 카운트는 ElementType 안에 있습니다.
+
+		ElementType은 아래 중 하나를 만족해야 합니다.
+			- IntrusiveRefCounted< ElementType >를 상속합니다. ( 원자적 레퍼런스 카운트를 제공합니다. )
+			- 또는 ADL로 찾을 수 있는 IntrusiveAddRef( const ElementType* ), IntrusiveRelease( const ElementType* ), IntrusiveUseCount( const ElementType* )를 제공합니다.
+			  ( 이미 자체 레퍼런스 카운트를 가진 타입을 연결할 때 사용합니다. )
+
+		주의 해야할 것은,
+			- weak_ptr과 같은 약한 참조는 지원하지 않습니다.
+			- 마지막 참조가 사라질 때 delete로 해제하므로, EmplaceNotNull, MakeIntrusive 등 new로 생성된 개체만 담아야 합니다.
+
+		[ Version ]
+		// 0.1
+			- NotNull, Nullable이 포인터 크기의 핸들을 가질 수 있도록, 레퍼런스 카운트를 개체 내부에 두는 IntrusivePtr을 추가하였습니다.
+	*/
+
+	template < typename Derived >
+	class IntrusiveRefCounted
+	{
+	private:
+		mutable std::atomic< std::uint32_t > m_refCount{ 0 };
+
+	protected:
+		IntrusiveRefCounted() noexcept = default;
+
+		// 레퍼런스 카운트는 개체마다 따로 존재하므로, 복사되지 않습니다.
+		IntrusiveRefCounted( const IntrusiveRefCounted& ) noexcept
+			: m_refCount{ 0 }
+		{
+		}
+
+		IntrusiveRefCounted& operator=( const IntrusiveRefCounted& ) noexcept
+		{
+			return *this;
+		}
+
+		~IntrusiveRefCounted() noexcept = default;
+
+	public:
+		friend void IntrusiveAddRef( const Derived* const ptr ) noexcept
+		{
+			static_cast< const IntrusiveRefCounted* >( ptr )->m_refCount.fetch_add( 1, std::memory_order_relaxed );
+		}
+
+		friend void IntrusiveRelease( const Derived* const ptr ) noexcept
+		{
+			if ( static_cast< const IntrusiveRefCounted* >( ptr )->m_refCount.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+				delete ptr;
+		}
+
+		friend long IntrusiveUseCount( const Derived* const ptr ) noexcept
+		{
+			return static_cast< long >( static_cast< const IntrusiveRefCounted* >( ptr )->m_refCount.load( std::memory_order_relaxed ) );
+		}
+	};
+
+	template < typename T >
+	class IntrusivePtr
+	{
+	public:
+		using element_type = T;
+
+	private:
+		T* m_ptr;
+
+	public:
+		IntrusivePtr() noexcept
+			: m_ptr{ nullptr }
+		{
+		}
+
+		IntrusivePtr( std::nullptr_t ) noexcept
+			: m_ptr{ nullptr }
+		{
+		}
+
+		// ptr의 레퍼런스 카운트를 증가시키며 소유합니다.
+		explicit IntrusivePtr( T* const ptr ) noexcept
+			: m_ptr{ ptr }
+		{
+			if ( m_ptr )
+				IntrusiveAddRef( m_ptr );
+		}
+
+		IntrusivePtr( const IntrusivePtr& rhs ) noexcept
+			: IntrusivePtr( rhs.m_ptr )
+		{
+		}
+
+		IntrusivePtr( IntrusivePtr&& rhs ) noexcept
+			: m_ptr{ std::exchange( rhs.m_ptr, nullptr ) }
+		{
+		}
+
+		~IntrusivePtr() noexcept
+		{
+			if ( m_ptr )
+				IntrusiveRelease( m_ptr );
+		}
+
+		IntrusivePtr& operator=( const IntrusivePtr& rhs ) noexcept
+		{
+			// 같은 개체를 가리키는 경우, 레퍼런스 카운트의 증가, 감소를 생략합니다.
+			if ( m_ptr == rhs.m_ptr )
+				return *this;
+
+			IntrusivePtr( rhs ).Swap( *this );
+			return *this;
+		}
+
+		IntrusivePtr& operator=( IntrusivePtr&& rhs ) noexcept
+		{
+			IntrusivePtr( std::move( rhs ) ).Swap( *this );
+			return *this;
+		}
+
+		IntrusivePtr& operator=( std::nullptr_t ) noexcept
+		{
+			IntrusivePtr().Swap( *this );
+			return *this;
+		}
+
+		void Swap( IntrusivePtr& rhs ) noexcept
+		{
+			std::swap( m_ptr, rhs.m_ptr );
+		}
+
+		// std::swap( NotNull의 이동 할당 )에서 사용됩니다.
+		friend void swap( IntrusivePtr& lhs, IntrusivePtr& rhs ) noexcept
+		{
+			lhs.Swap( rhs );
+		}
+
+		T* get() const noexcept
+		{
+			return m_ptr;
+		}
+
+		T& operator*() const noexcept
+		{
+			return *m_ptr;
+		}
+
+		T* operator->() const noexcept
+		{
+			return m_ptr;
+		}
+
+		long use_count() const noexcept
+		{
+			return m_ptr ? IntrusiveUseCount( m_ptr ) : 0;
+		}
+
+		bool operator==( std::nullptr_t ) const noexcept
+		{
+			return m_ptr == nullptr;
+		}
+
+		bool operator==( const IntrusivePtr& rhs ) const noexcept
+		{
+			return m_ptr == rhs.m_ptr;
+		}
+
+		explicit operator bool() const noexcept
+		{
+			return m_ptr != nullptr;
+		}
+	};
+
+	// new로 ElementType을 생성하여 IntrusivePtr로 반환합니다.
+	template < typename T, typename... Args >
+	[[nodiscard]] IntrusivePtr< T > MakeIntrusive( Args&&... args )
+	{
+		return IntrusivePtr< T >( new T( std::forward< Args >( args )... ) );
+	}
+}
+
+#endif
@@ -0,0 +1,219 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_LAZY_NOTNULL
+#define WONSY_LAZY_NOTNULL
+
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		처음 접근할 때 ElementType을 생성하는 NotNull입니다.
+
+		생성 비용이 크지만 드물게 사용되는 NotNull 멤버를 생성자에서 MakeNotNull하면, 시작 시간과 메모리가 늘어납니다.
+		LazyNotNull은 factory만 가지고 있다가, 처음 접근( operator(), operator ElementType&, GetNotNull )할 때 factory로 NotNull을 생성합니다.
+
+			- LazyThreadMode::Safe     : 여러 스레드에서 동시에 처음 접근하더라도 생성은 한 번만 일어납니다. 생성 이후의 접근은 lock 없이 원자적 읽기( acquire ) 한 번으로 처리됩니다.
+			- LazyThreadMode::Confined : 한 스레드에서만 사용하는 경우로, 원자 연산과 mutex를 사용하지 않습니다. 디버그 빌드에서는 다른 스레드에서의 접근을 assert로 확인합니다.
+			- factory를 받지 않으면, EmplaceNotNull()로 생성합니다.
+			- factory에서 예외가 발생하면 예외는 접근한 스레드로 전달되며, 다음 접근에서 다시 생성을 시도합니다.
+			- 생성된 이후에는 NotNull< Type >처럼 사용할 수 있으며, const NotNull< Type >&, Nullable< Type >으로 변환됩니다.
+
+		주의 해야할 것은,
+			- 복사, 이동할 수 없습니다. ( 멤버 변수로 사용하는 것을 전제로 합니다. )
+			- factory는 std::function에 담기므로, 복사 가능해야 합니다. 생성 이후 factory는 해제됩니다.
+			- const 함수에서도 처음 접근 시 생성됩니다. ( NotNull과 같이, const는 ElementType이 아닌 포인터에 대한 것입니다. )
+
+		[ Version ]
+		// 0.1
+			- 생성 비용이 큰 NotNull 멤버를 처음 사용할 때 생성하기 위해, LazyNotNull을 추가하였습니다.
+
+		// 0.2
+			- NDEBUG 여부에 따라 LazyNotNull의 구성이 달라지던( ODR 위반 ) 문제를 수정하였습니다. ( 스레드 확인만 디버그 빌드에서 처리합니다. )
+			  스레드를 확인하지 않는 Safe는, 스레드 id를 위한 크기를 차지하지 않습니다.
+	*/
+
+	enum class LazyThreadMode
+	{
+		Safe,
+		Confined
+	};
+
+	template< NotNullRequire _Type, LazyThreadMode ThreadMode = LazyThreadMode::Safe >
+	class LazyNotNull
+	{
+	public:
+		using Type        = _Type;
+		using ElementType = WsyElementType< _Type >::Type;
+		using NotNullType = NotNull< Type >;
+		using FactoryType = std::function< NotNullType() >;
+
+		static constexpr bool IsThreadSafe = ThreadMode == LazyThreadMode::Safe;
+
+	private:
+		class EmptyMutex
+		{
+		public:
+			void lock() noexcept {}
+			void unlock() noexcept {}
+		};
+
+		class EmptyThreadId
+		{
+		};
+
+		using CreatedFlagType = std::conditional_t< IsThreadSafe, std::atomic< bool >, bool >;
+		using MutexType       = std::conditional_t< IsThreadSafe, std::mutex, EmptyMutex >;
+		using ThreadIdType    = std::conditional_t< IsThreadSafe, EmptyThreadId, std::thread::id >;
+
+		mutable CreatedFlagType                   m_isCreated{ false };
+		mutable std::optional< NotNullType >      m_notNull;
+		mutable FactoryType                       m_factory;
+		[[no_unique_address]] mutable MutexType   m_mutex;
+
+		// NDEBUG 여부와 상관 없이 클래스의 구성이 같도록 항상 가지고 있으며, 확인( assert )만 디버그 빌드에서 처리합니다.
+		// 확인하지 않는 Safe는 크기를 차지하지 않습니다.
+		[[no_unique_address]] ThreadIdType        m_ownerThreadId{ _GetOwnerThreadId() };
+
+		[[nodiscard]] static ThreadIdType _GetOwnerThreadId() noexcept
+		{
+			if constexpr ( IsThreadSafe )
+				return {};
+			else
+				return std::this_thread::get_id();
+		}
+
+		void _CheckThread() const noexcept
+		{
+#ifndef NDEBUG
+			if constexpr ( !IsThreadSafe )
+				assert( m_ownerThreadId == std::this_thread::get_id() && "LazyNotNull( Confined ) is used by another thread" );
+#endif
+		}
+
+		[[nodiscard]] bool _IsCreated( const std::memory_order order ) const noexcept
+		{
+			if constexpr ( IsThreadSafe )
+				return m_isCreated.load( order );
+			else
+				return m_isCreated;
+		}
+
+		// 처음 접근할 때만 호출되는 경로입니다.
+		const NotNullType& _Create() const
+		{
+			std::lock_guard lock( m_mutex );
+			if ( !_IsCreated( std::memory_order_relaxed ) )
+			{
+				if ( m_factory )
+					m_notNull.emplace( m_factory() );
+				else
+					m_notNull.emplace( NotNullType::EmplaceNotNull() );
+
+				m_factory = nullptr;
+
+				if constexpr ( IsThreadSafe )
+					m_isCreated.store( true, std::memory_order_release );
+				else
+					m_isCreated = true;
+			}
+
+			return *m_notNull;
+		}
+
+	public:
+#pragma region [ CTOR, DTOR ]
+		// EmplaceNotNull()로 생성합니다.
+		LazyNotNull() noexcept
+			requires std::is_default_constructible_v< ElementType >
+		{
+		}
+
+		// factory()가 반환하는 NotNull< Type >로 생성합니다.
+		template< typename Factory >
+			requires std::is_convertible_v< std::invoke_result_t< Factory& >, NotNullType >
+		explicit LazyNotNull( Factory&& factory )
+			: m_factory( std::forward< Factory >( factory ) )
+		{
+		}
+
+		LazyNotNull( const LazyNotNull& )            = delete;
+		LazyNotNull& operator=( const LazyNotNull& ) = delete;
+#pragma endregion
+
+#pragma region [ Access ]
+		// 생성되지 않았다면 생성한 후, NotNull을 반환합니다.
+		[[nodiscard]] const NotNullType& GetNotNull() const
+		{
+			_CheckThread();
+
+			if ( _IsCreated( std::memory_order_acquire ) ) [[likely]]
+				return *m_notNull;
+
+			return _Create();
+		}
+
+		// 생성을 유발하지 않습니다.
+		[[nodiscard]] bool IsCreated() const noexcept
+		{
+			return _IsCreated( std::memory_order_acquire );
+		}
+
+		operator const NotNullType&() const
+		{
+			return GetNotNull();
+		}
+
+		// 생성되지 않았다면 생성한 후, Nullable로 복사합니다. ( 복사 가능한 Type만 사용할 수 있습니다. )
+		operator Nullable< Type >() const
+			requires std::is_copy_constructible_v< Type >
+		{
+			return Nullable< Type >( GetNotNull() );
+		}
+
+		operator ElementType&() const
+		{
+			return GetNotNull()();
+		}
+
+		// 위 Opertator이 의도와 다르게, 동작되지 않을 때 사용합니다.
+		ElementType& operator()() const
+		{
+			return GetNotNull()();
+		}
+#pragma endregion
+	};
+}
+
+template< typename T, WonSY::LazyThreadMode ThreadMode = WonSY::LazyThreadMode::Safe >
+using WsyLazyNotNull = WonSY::LazyNotNull< T, ThreadMode >;
+
+template< typename T >
+using WsyLocalLazyNotNull = WonSY::LazyNotNull< T, WonSY::LazyThreadMode::Confined >;
+
+template< typename T >
+using WsyLazyNotNullShared = WonSY::LazyNotNull< WsySharedPtr< T > >;
+
+template< typename T >
+using WsyLazyNotNullUnique = WonSY::LazyNotNull< WsyUniquePtr< T > >;
+
+#endif
@@ -0,0 +1,268 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_LOCAL_SHARED_PTR
+#define WONSY_LOCAL_SHARED_PTR
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_Allocator.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull< LocalSharedPtr< T > >, Nullable< LocalSharedPtr< T > >로 사용하는, 한 스레드 안에서만 공유되는 스마트 포인터입니다.
+
+		shared_ptr은 복사, 소멸 시마다 레퍼런스 카운트를 원자적으로 증가, 감소시킵니다.
+		존( Zone )별 스레드처럼 한 스레드에 한정된 데이터라면, 이 원자 연산은 불필요한 비용이므로 일반 정수로 레퍼런스 카운트를 관리합니다.
+
+			- 레퍼런스 카운트와 ElementType은 하나의 블록에 함께 할당되며, LocalSharedPtr은 블록의 포인터만 가집니다. ( 포인터 크기 )
+			- MakeLocalShared( new ), AllocateLocalShared( Allocator )로만 생성할 수 있습니다. ( 이미 생성된 T*를 받지 않습니다. )
+
+		주의 해야할 것은,
+			- 처음 생성한 스레드에서만 복사, 소멸, 할당해야 합니다. 디버그 빌드에서는 다른 스레드에서의 접근을 assert로 확인합니다.
+			- weak_ptr과 같은 약한 참조는 지원하지 않습니다.
+
+		[ Version ]
+		// 0.1
+			- 스레드에 한정된 데이터의 복사 시 원자 연산을 피하기 위해, 원자적이지 않은 LocalSharedPtr을 추가하였습니다.
+
+		// 0.2
+			- NDEBUG 여부에 따라 ControlBlock의 구성이 달라지던( ODR 위반 ) 문제를 수정하였습니다. ( 스레드 확인만 디버그 빌드에서 처리합니다. )
+	*/
+
+	template < typename T >
+	class LocalSharedPtr
+	{
+	public:
+		using element_type = T;
+
+	private:
+		// 레퍼런스 카운트와 ElementType이 함께 들어가는 블록입니다.
+		class ControlBlock
+		{
+		public:
+			using DestroyFunc = void ( * )( ControlBlock* ) noexcept;
+
+			std::size_t refCount;
+			DestroyFunc destroyFunc;
+
+			// NDEBUG 여부와 상관 없이 블록의 구성이 같도록 항상 가지고 있으며, 확인( assert )만 디버그 빌드에서 처리합니다.
+			std::thread::id ownerThreadId;
+			T           element;
+
+			template< typename... Args >
+			explicit ControlBlock( const DestroyFunc inDestroyFunc, Args&&... args )
+				: refCount     { 1                                }
+				, destroyFunc  { inDestroyFunc                    }
+				, ownerThreadId{ std::this_thread::get_id()       }
+				, element      ( std::forward< Args >( args )... )
+			{
+			}
+
+			void CheckThread() const noexcept
+			{
+#ifndef NDEBUG
+				assert( ownerThreadId == std::this_thread::get_id() && "LocalSharedPtr is used by another thread" );
+#endif
+			}
+		};
+
+		// Allocator로 할당된 블록으로, 해제 시 사용할 Allocator를 함께 가지고 있습니다.
+		template< typename Alloc >
+		class AllocatedControlBlock
+			: public ControlBlock
+		{
+		public:
+			using ReboundType = ReboundAllocator< AllocatedControlBlock, Alloc >;
+
+			[[no_unique_address]] ReboundType alloc;
+
+			template< typename... Args >
+			explicit AllocatedControlBlock( const ReboundType& inAlloc, Args&&... args )
+				: ControlBlock( &AllocatedControlBlock::_Destroy, std::forward< Args >( args )... )
+				, alloc       { inAlloc                                                           }
+			{
+			}
+
+		private:
+			static void _Destroy( ControlBlock* const block ) noexcept
+			{
+				AllocatedControlBlock* const allocatedBlock = static_cast< AllocatedControlBlock* >( block );
+
+				ReboundType rebound( allocatedBlock->alloc );
+				std::allocator_traits< ReboundType >::destroy( rebound, allocatedBlock );
+				std::allocator_traits< ReboundType >::deallocate( rebound, allocatedBlock, 1 );
+			}
+		};
+
+		ControlBlock* m_block;
+
+		explicit LocalSharedPtr( ControlBlock* const block ) noexcept
+			: m_block{ block }
+		{
+		}
+
+		static void _Delete( ControlBlock* const block ) noexcept
+		{
+			delete block;
+		}
+
+		void _Release() noexcept
+		{
+			if ( !m_block )
+				return;
+
+			m_block->CheckThread();
+
+			if ( --m_block->refCount == 0 )
+				m_block->destroyFunc( m_block );
+		}
+
+	public:
+		LocalSharedPtr() noexcept
+			: m_block{ nullptr }
+		{
+		}
+
+		LocalSharedPtr( std::nullptr_t ) noexcept
+			: m_block{ nullptr }
+		{
+		}
+
+		LocalSharedPtr( const LocalSharedPtr& rhs ) noexcept
+			: m_block{ rhs.m_block }
+		{
+			if ( m_block )
+			{
+				m_block->CheckThread();
+				++m_block->refCount;
+			}
+		}
+
+		LocalSharedPtr( LocalSharedPtr&& rhs ) noexcept
+			: m_block{ std::exchange( rhs.m_block, nullptr ) }
+		{
+		}
+
+		~LocalSharedPtr() noexcept
+		{
+			_Release();
+		}
+
+		LocalSharedPtr& operator=( const LocalSharedPtr& rhs ) noexcept
+		{
+			// 같은 블록을 가리키는 경우, 레퍼런스 카운트의 증가, 감소를 생략합니다.
+			if ( m_block == rhs.m_block )
+				return *this;
+
+			LocalSharedPtr( rhs ).Swap( *this );
+			return *this;
+		}
+
+		LocalSharedPtr& operator=( LocalSharedPtr&& rhs ) noexcept
+		{
+			LocalSharedPtr( std::move( rhs ) ).Swap( *this );
+			return *this;
+		}
+
+		LocalSharedPtr& operator=( std::nullptr_t ) noexcept
+		{
+			LocalSharedPtr().Swap( *this );
+			return *this;
+		}
+
+		void Swap( LocalSharedPtr& rhs ) noexcept
+		{
+			std::swap( m_block, rhs.m_block );
+		}
+
+		// std::swap( NotNull의 이동 할당 )에서 사용됩니다.
+		friend void swap( LocalSharedPtr& lhs, LocalSharedPtr& rhs ) noexcept
+		{
+			lhs.Swap( rhs );
+		}
+
+		T* get() const noexcept
+		{
+			return m_block ? std::addressof( m_block->element ) : nullptr;
+		}
+
+		T& operator*() const noexcept
+		{
+			return m_block->element;
+		}
+
+		T* operator->() const noexcept
+		{
+			return std::addressof( m_block->element );
+		}
+
+		long use_count() const noexcept
+		{
+			if ( !m_block )
+				return 0;
+
+			m_block->CheckThread();
+			return static_cast< long >( m_block->refCount );
+		}
+
+		bool operator==( std::nullptr_t ) const noexcept
+		{
+			return m_block == nullptr;
+		}
+
+		bool operator==( const LocalSharedPtr& rhs ) const noexcept
+		{
+			return m_block == rhs.m_block;
+		}
+
+		explicit operator bool() const noexcept
+		{
+			return m_block != nullptr;
+		}
+
+		// new로 블록을 할당하여 ElementType을 생성합니다.
+		template< typename... Args >
+		[[nodiscard]] static LocalSharedPtr DoNotCall_____MAKE_LOCAL_SHARED( Args&&... args )
+		{
+			return LocalSharedPtr( new ControlBlock( &LocalSharedPtr::_Delete, std::forward< Args >( args )... ) );
+		}
+
+		// alloc으로 블록을 할당하여 ElementType을 생성합니다. 마지막 참조가 사라질 때 같은 alloc으로 돌려줍니다.
+		template< AllocatorType Alloc, typename... Args >
+		[[nodiscard]] static LocalSharedPtr DoNotCall_____ALLOCATE_LOCAL_SHARED( const Alloc& alloc, Args&&... args )
+		{
+			using Block = AllocatedControlBlock< Alloc >;
+
+			const typename Block::ReboundType rebound( alloc );
+			return LocalSharedPtr( AllocateElement< Block >( rebound, rebound, std::forward< Args >( args )... ) );
+		}
+	};
+
+	template < typename T, typename... Args >
+	[[nodiscard]] LocalSharedPtr< T > MakeLocalShared( Args&&... args )
+	{
+		return LocalSharedPtr< T >::DoNotCall_____MAKE_LOCAL_SHARED( std::forward< Args >( args )... );
+	}
+
+	template < typename T, AllocatorType Alloc, typename... Args >
+	[[nodiscard]] LocalSharedPtr< T > AllocateLocalShared( const Alloc& alloc, Args&&... args )
+	{
+		return LocalSharedPtr< T >::DoNotCall_____ALLOCATE_LOCAL_SHARED( alloc, std::forward< Args >( args )... );
+	}
+}
+
+#endif
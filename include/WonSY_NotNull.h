@@ -18,49 +18,103 @@
 
 #endif
 
+#include <cassert>
+#include <compare>
+#include <cstdint>
 #include <memory>
 #include <functional>
+#include <utility>
 
 #include "WonSY_TypeUtil.h"
+#include "WonSY_Allocator.h"
+#include "WonSY_Inline.h"
+#include "WonSY_IntrusivePtr.h"
+#include "WonSY_LocalSharedPtr.h"
+#include "WonSY_TaggedPtr.h"
 
 
 namespace WonSY
 {
 	/*
-		"׻ Null ƴ Ptr " ǹϴ NotNull Nullable Ȯǰų, elementType ٷ   ֽϴ.
+		"항상 Null이 아닌 Ptr의 개념"을 의미하는 NotNull로 Nullable에서 확장되거나, elementType으로 바로 만들 수 있습니다.
 		 
-		Ÿδ, RawPointer SharedPtr, UniquePtr ϸ,  Ʈ Ư ״ Ȱմϴ.
+		타입으로는, RawPointer와 SharedPtr, UniquePtr를 지원하며, 각 포인트의 특성을 그대로 활용합니다.
 
 		[ Version ]
 		// 0.1 
-			-  C++ ǥ Ϳ  ģδ Null õ ̽ ϱ ƴٰ ǴϿ, ̸ غϱ  ο ģ 
+			- 기존의 C++ 표준의 포인터와 그 친구들로는 Null과 관련된 이슈에서 안전하기 어렵다고 판단하여, 이를 극복하기 위한 새로운 친구 제작
 
 		// 0.2
-			- NotNullRequire Concept  ( IsRawPtr< T >::value || IsSharedPtr< T >::value || IsUniquePtr< T >::value )
+			- NotNullRequire Concept 개념 적용( IsRawPtr< T >::value || IsSharedPtr< T >::value || IsUniquePtr< T >::value )
 		
 		// 0.3 
-			- NotNull( const ElementType& dataElement ) IsRawPtr< T > ó ,  ޸ ȸ ̽  Ʊ ,
-			  RawPtr Notnull ٷ  ̽ մϴ.
+			- NotNull( const ElementType& dataElement )을 IsRawPtr< T >로 처리 시, 적절한 메모리 회수 인터페이스 제공이 어렵기 때문에,
+			  RawPtr로 Notnull을 바로 만드는 케이스를 제한합니다.
 
 		// 0.4 
-			- T shared_ptr  , UseCount ȯ  ֵ óմϴ.
-			- ElementType ڷ ޵Ǿ , enable_shared_from_this()  ο , shared_from_this() óϴ  ߸Ȱ ȮεǾ մϴ.
-			- Ī WsyNotNullRaw, WsyNotNullShared, WsyNotNullUnique ߰Ͽϴ.
+			- T가 shared_ptr 일 경우, UseCount를 반환할 수 있도록 처리합니다.
+			- ElementType가 인자로 전달되었을 때, enable_shared_from_this()의 상속 여부에 따라, shared_from_this() 처리하던 로직은 잘못된것임이 확인되어 제거합니다.
+			- 별칭 WsyNotNullRaw, WsyNotNullShared, WsyNotNullUnique 추가하였습니다.
 
 		// 0.5
-			- ElementType&() operaotr  ó ǵ ٸ  ʴ ̽ Ȯؼ,    Լ "Data()"   ֵ ߰Ͽϴ.
+			- ElementType&() operaotr 의 처리가 의도와 다르게 동작하지 않는 케이스를 확인해서, 그 경우의 명시적으로 멤버함수 "Data()"를 사용할 수 있도록 추가하였습니다.
+
+		// 0.6
+			- MakeNotNull이 이미 생성된 ElementType을 받아 다시 복사하던 것을, 생성자 인자를 그대로 전달하는 EmplaceNotNull로 제자리 생성할 수 있도록 추가하였습니다.
+			  ( MakeNotNull 또한 내부적으로 같은 생성자를 사용합니다. )
+
+		// 0.7
+			- 기본 이동 생성자, 이동 할당은 원본을 null로 만들어, NotNull의 유효성이 깨질 수 있었습니다.
+			  이동 할당은 swap으로 처리하여 양쪽 모두 유효성을 유지하고, 이동 생성된 원본은 접근 불가능한 상태로 보고 디버그 빌드에서 assert합니다.
+			- rvalue의 경우 m_data를 복사하지 않고 옮길 수 있도록, DoNotCall 함수들의 rvalue 버전을 추가하였습니다.
+
+		// 0.8
+			- Allocator, memory_resource에서 할당하는 AllocateNotNull을 추가하였습니다.
+			  unique_ptr은 AllocatorDeleter를 Deleter로 사용하는 타입( WsyUniquePtrAlloc, WsyUniquePtrPmr )만 지원합니다.
+
+		// 0.9
+			- 작은 ElementType을 힙 할당 없이 직접 담는 Inline< T >를 지원합니다. ( NotNullRequire에 IsInline< T > 추가 )
+
+		// 0.10
+			- 레퍼런스 카운트를 개체 내부에 두어, 포인터 크기의 핸들을 가지는 IntrusivePtr< T >를 지원합니다. ( NotNullRequire에 IsIntrusivePtr< T > 추가 )
+			- T가 IntrusivePtr 일 경우에도, UseCount를 반환할 수 있도록 처리합니다.
+
+		// 0.11
+			- 한 스레드 안에서 원자 연산 없이 공유되는 LocalSharedPtr< T >를 지원합니다. ( NotNullRequire에 IsLocalSharedPtr< T > 추가 )
+			  MakeNotNull, EmplaceNotNull, AllocateNotNull, GetUseCount 모두 shared_ptr과 동일하게 사용할 수 있습니다.
+
+		// 0.12
+			- NotNullRequire를 고정된 타입 목록 대신, 사용자 타입이 특수화할 수 있는 PointerTraits< T >로 판단합니다. ( WonSY_TypeUtil.h 참고 )
+			  null 확인과 역참조는 PointerTraits를 통하며, 사용자 타입의 생성( Make )과 UseCount도 PointerTraits에 정의된 경우 사용합니다.
+
+		// 0.13
+			- 포인터의 하위 비트에 소유권과 사용자 Tag를 담는 TaggedPtr< T >를 지원하며, Tag에 접근하는 IsOwner, HasTag, SetTag를 추가하였습니다.
+
+		// 0.14
+			- Type이 변환을 허용하는 다른 Type의 NotNull에서의 암시적 변환( Derived에서 Base로의 업캐스트, unique_ptr에서 shared_ptr 등 )을 추가하였습니다.
+			  rvalue에서의 변환은 레퍼런스 카운트 변화 없이 옮겨옵니다. 명시적인 캐스트는 WonSY_PointerCast.h의 StaticCast, DynamicCast, ConstCast를 사용합니다.
+
+		// 0.15
+			- 가리키는 개체( Identity, 기본적으로 주소 )로 비교하는 operator==, operator<=>와 std::hash를 추가하였습니다. ( ElementType의 값을 비교하지 않습니다. )
+			  unordered_set, unordered_map의 키로 사용하거나, 주소 순으로 정렬할 수 있습니다. ( Inline< T >는 담고 있는 NotNull 자신의 주소입니다. )
+
+		// 0.16
+			- 소멸자가 아닌 PointerTraits< Type >::Release로만 해제되는 Type( TaggedPtr< T > 등 )은, 해제할 방법이 없으므로 MakeNotNull, EmplaceNotNull을 제한하였습니다.
 
 		[ Known Issue ]
-			- [ Ver 0.3  ]IsRawPtr< T > NotNull ٷ  ̽ , ޸𸮸   , ޸𸮸 ߻Ѵ. ̿ õǾ   ʿϴ.
-			- New ϴ ̽ ؼ  ó   ֽϴ.
+			- [ Ver 0.3에서 제한 ]IsRawPtr< T >로 NotNull로 바로 만든 케이스의 경우, 메모리를 해제해줄 방법이 없어, 메모리릭이 발생한다. 이와 관련되어 개선사항의 고려가 필요하다.
+			- New가 실패하는 케이스에 대해서는 정상적으로 처리하지 못할 수 있습니다.
 	*/
 
 	template < typename T >
-	concept NotNullRequire = IsRawPtr< T >::value || IsSharedPtr< T >::value || IsUniquePtr< T >::value;
+	concept NotNullRequire = PointerTraitsType< T >;
 
 	template< NotNullRequire _Type >
 	class [[nodiscard]] NotNull
 	{
+		// WonSY_PointerCast.h, 캐스트에 실패한 경우 원본을 유지하기 위해 m_data에 직접 접근합니다.
+		friend class PointerCast;
+
 	public:
 		using Type        = _Type;
 		using ElementType = WsyElementType< _Type >::Type;
@@ -70,52 +124,188 @@ namespace WonSY
 
 	public:
 #pragma region [ CTOR, DTOR ]
-		// ⺻ ڴ մϴ.
+		// 기본 생성자는 제거합니다.
 		NotNull() = delete;
 		
-		// Ҹ
+		// 소멸자
 		~NotNull() noexcept = default;
-		//  ؾ , Nullable ޸   Ʈ Ͱ ƴϹǷ, 
-		// Ҹڿ Ƿ ޸𸮿 õ ó  ʽϴ.
-		// ᱹ Type  Ҹ  ۴ ó Դϴ.
+		// 주의 해야할 것은, Nullable은 메모리 관리를 위한 스마트 포인터가 아니므로, 
+		// 소멸자에서 임의로 메모리와 관련된 처리를 해주지 않습니다.
+		// 결국 Type 본연의 소멸 시 동작대로 처리될 것입니다.
+
+		// 기존에 이미 NotNull< T >인 경우, 데이터가 항상 유효하기 때문에 복사해준다.
+		NotNull( const NotNull< Type >& )            = default;
+		NotNull& operator=( const NotNull< Type >& ) = default;
+
+		// 이동 생성은 레퍼런스 카운트 변화 없이 m_data를 그대로 옮깁니다.
+		// 이동된 원본( rhs )은 소멸되거나, 새로 할당받기 전까지는 접근해서는 안되는 상태이며, 디버그 빌드에서는 접근 시 assert로 확인합니다.
+		NotNull( NotNull< Type >&& ) noexcept = default;
 
-		//  ̹ NotNull< T > , Ͱ ׻ ȿϱ  ش.
-		NotNull( const NotNull< Type >& )                = default;
-		NotNull& operator=( const NotNull< Type >& )     = default;
-		NotNull( NotNull< Type >&& ) noexcept            = default;
-		NotNull& operator=( NotNull< Type >&& ) noexcept = default;
+		// 이동 할당은 서로의 m_data를 교환하므로, 양쪽 모두 NotNull의 유효성이 유지됩니다.
+		NotNull& operator=( NotNull< Type >&& rhs ) noexcept
+		{
+			std::swap( m_data, rhs.m_data );
+			return *this;
+		}
+
+		// Type으로 변환될 수 있는 다른 Type의 NotNull에서의 변환( 업캐스트 등 )은 언제든지 가능하며, 변환 결과 또한 null이 아닙니다.
+		// shared_ptr은 컨트롤 블록을 공유하므로 추가 할당이 없습니다.
+		template< NotNullRequire OtherType >
+			requires ( !std::is_same_v< OtherType, Type > && std::is_convertible_v< const OtherType&, Type > )
+		NotNull( const NotNull< OtherType >& rhs )
+			: m_data( rhs.DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
+		{
+		}
+
+		// 소멸될 NotNull( rvalue )에서의 변환은, 레퍼런스 카운트 변화 없이 옮겨온다. ( unique_ptr에서 shared_ptr로의 변환 등 )
+		// unique_ptr에서 shared_ptr로의 변환은 컨트롤 블록을 할당하므로, 예외가 발생할 수 있습니다. ( Type의 변환이 noexcept일 때만 noexcept입니다. )
+		template< NotNullRequire OtherType >
+			requires ( !std::is_same_v< OtherType, Type > && std::is_convertible_v< OtherType&&, Type > )
+		NotNull( NotNull< OtherType >&& rhs ) noexcept( std::is_nothrow_constructible_v< Type, OtherType&& > )
+			: m_data( std::move( rhs ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
+		{
+		}
+
+		// 할당 또한 같으며, operator=( const ElementType& )로 값이 복사되지 않도록 별도로 정의합니다.
+		template< NotNullRequire OtherType >
+			requires ( !std::is_same_v< OtherType, Type > && std::is_convertible_v< const OtherType&, Type > )
+		NotNull& operator=( const NotNull< OtherType >& rhs )
+		{
+			m_data = rhs.DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD();
+			return *this;
+		}
+
+		template< NotNullRequire OtherType >
+			requires ( !std::is_same_v< OtherType, Type > && std::is_convertible_v< OtherType&&, Type > )
+		NotNull& operator=( NotNull< OtherType >&& rhs ) noexcept( std::is_nothrow_assignable_v< Type&, OtherType&& > )
+		{
+			m_data = std::move( rhs ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD();
+			return *this;
+		}
 
 	private:
-		// ڸ privateϰ óϰ FactoryFunc( MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU )θ Ѵ.
+		// 생성자를 private하게 처리하고 FactoryFunc( MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU )로만 제공한다.
 		NotNull( const Type& data )
 			: m_data{ data }
 		{
 		}
 
-		// ڸ privateϰ óϰ FactoryFunc( MakeNotNull )θ Ѵ.
-		NotNull( const ElementType& dataElement )
+		NotNull( Type&& data ) noexcept
+			: m_data{ std::move( data ) }
+		{
+		}
+
+		// 생성자를 private하게 처리하고 FactoryFunc( MakeNotNull, EmplaceNotNull )로만 제공한다.
+		// 인자들을 그대로 할당되는 메모리에 전달하여, ElementType을 제자리에서 생성합니다.
+		template< typename... Args >
+		explicit NotNull( std::in_place_t, Args&&... args )
 			: m_data{ nullptr }
 		{
 			if constexpr ( WonSY::IsRawPtr< Type >::value )
 			{
-				// m_data = new ElementType( dataElement );
+				// m_data = new ElementType( std::forward< Args >( args )... );
 				WONSY_FAIL_STATIC_ASSERT( "Because there is no suitable interface for memory release, limit the case of creating NotNull < T*> directly with ElementType." );
 			}
 			else if constexpr ( WonSY::IsSharedPtr< Type >::value )
 			{
-				// [ ver 0.4 ] ;
+				// [ ver 0.4 ] 으악;
 				//if constexpr ( std::derived_from< ElementType, std::enable_shared_from_this< ElementType > > )
 				//{
 				//	m_data = dataElement.shared_from_this();
 				//}
 				//else
 				//{
-					m_data = std::make_shared< ElementType >( dataElement );
+					m_data = std::make_shared< ElementType >( std::forward< Args >( args )... );
 				//}
 			}
 			else if constexpr ( WonSY::IsUniquePtr< Type >::value )
 			{
-				m_data = std::make_unique< ElementType >( dataElement );
+				if constexpr ( std::is_same_v< typename WonSY::IsUniquePtr< Type >::DeleterType, std::default_delete< ElementType > > )
+				{
+					m_data = std::make_unique< ElementType >( std::forward< Args >( args )... );
+				}
+				else
+				{
+					WONSY_FAIL_STATIC_ASSERT( "unique_ptr with a custom deleter must be created with AllocateNotNull." );
+				}
+			}
+			else if constexpr ( WonSY::IsInline< Type >::value )
+			{
+				m_data.Emplace( std::forward< Args >( args )... );
+			}
+			else if constexpr ( WonSY::IsIntrusivePtr< Type >::value )
+			{
+				m_data = MakeIntrusive< ElementType >( std::forward< Args >( args )... );
+			}
+			else if constexpr ( WonSY::IsLocalSharedPtr< Type >::value )
+			{
+				m_data = MakeLocalShared< ElementType >( std::forward< Args >( args )... );
+			}
+			else if constexpr ( PointerTraitsMakeable< Type, Args&&... > )
+			{
+				// Release로만 해제되는 Type( 소멸자가 해제하지 않는 TaggedPtr< T > 등 )은, Release가 없는 NotNull로 생성하면 해제할 방법이 없습니다.
+				if constexpr ( PointerTraitsReleasable< Type > && std::is_trivially_destructible_v< Type > )
+				{
+					WONSY_FAIL_STATIC_ASSERT( "Because NotNull has no Release, limit the case of creating NotNull < Type > that is released only by PointerTraits< Type >::Release. use MakeNullable or EmplaceNullable." );
+				}
+				else
+				{
+					m_data = PointerTraits< Type >::Make( std::forward< Args >( args )... );
+				}
+			}
+			else
+			{
+				WONSY_FAIL_STATIC_ASSERT( "unSupported Type! ( define PointerTraits< Type >::Make )" );
+			}
+		}
+
+		// 생성자를 private하게 처리하고 FactoryFunc( AllocateNotNull )로만 제공한다.
+		// 전역 힙 대신 alloc에서 ElementType을 할당합니다.
+		template< AllocatorType Alloc, typename... Args >
+		NotNull( std::allocator_arg_t, const Alloc& alloc, Args&&... args )
+			: m_data{ _AllocateData( alloc, std::forward< Args >( args )... ) }
+		{
+		}
+
+		// Deleter가 기본 생성 불가능할 수 있어, m_data를 바로 초기화하기 위해 사용합니다.
+		template< AllocatorType Alloc, typename... Args >
+		static Type _AllocateData( const Alloc& alloc, Args&&... args )
+		{
+			if constexpr ( WonSY::IsRawPtr< Type >::value )
+			{
+				WONSY_FAIL_STATIC_ASSERT( "Because there is no suitable interface for memory release, limit the case of creating NotNull < T*> directly with ElementType." );
+			}
+			else if constexpr ( WonSY::IsSharedPtr< Type >::value )
+			{
+				// 컨트롤 블록과 ElementType이 함께 alloc에서 할당되며, 마지막 참조가 사라질 때 alloc으로 돌려줍니다.
+				return std::allocate_shared< ElementType >( alloc, std::forward< Args >( args )... );
+			}
+			else if constexpr ( WonSY::IsUniquePtr< Type >::value )
+			{
+				using Deleter = typename WonSY::IsUniquePtr< Type >::DeleterType;
+
+				if constexpr ( WonSY::IsAllocatorDeleter< Deleter >::value )
+				{
+					const typename Deleter::ReboundType rebound( alloc );
+					return Type( AllocateElement< ElementType >( rebound, std::forward< Args >( args )... ), Deleter( rebound ) );
+				}
+				else
+				{
+					WONSY_FAIL_STATIC_ASSERT( "AllocateNotNull with unique_ptr requires WonSY::AllocatorDeleter. ( WsyUniquePtrAlloc, WsyUniquePtrPmr )" );
+				}
+			}
+			else if constexpr ( WonSY::IsInline< Type >::value )
+			{
+				WONSY_FAIL_STATIC_ASSERT( "Inline< T > does not allocate. use MakeNotNull or EmplaceNotNull." );
+			}
+			else if constexpr ( WonSY::IsIntrusivePtr< Type >::value )
+			{
+				WONSY_FAIL_STATIC_ASSERT( "IntrusivePtr< T > releases with delete. use MakeNotNull or EmplaceNotNull." );
+			}
+			else if constexpr ( WonSY::IsLocalSharedPtr< Type >::value )
+			{
+				// 레퍼런스 카운트와 ElementType이 함께 alloc에서 할당되며, 마지막 참조가 사라질 때 alloc으로 돌려줍니다.
+				return AllocateLocalShared< ElementType >( alloc, std::forward< Args >( args )... );
 			}
 			else
 			{
@@ -128,50 +318,88 @@ namespace WonSY
 #pragma region [ FactoryFunc Or Othres ]
 		[[nodiscard]] static NotNull< Type > MakeNotNull( const ElementType& ele )
 		{
-			return NotNull< Type >( ele );
+			return NotNull< Type >( std::in_place, ele );
+		}
+
+		// ElementType의 생성자 인자들을 받아, 복사 없이 바로 생성합니다. ( 복사, 이동이 불가능한 ElementType도 생성할 수 있습니다. )
+		template< typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] static NotNull< Type > EmplaceNotNull( Args&&... args )
+		{
+			return NotNull< Type >( std::in_place, std::forward< Args >( args )... );
+		}
+
+		// alloc에서 ElementType을 할당하여 생성합니다. ( shared_ptr은 allocate_shared, unique_ptr은 AllocatorDeleter를 사용합니다. )
+		template< AllocatorType Alloc, typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] static NotNull< Type > AllocateNotNull( const Alloc& alloc, Args&&... args )
+		{
+			return NotNull< Type >( std::allocator_arg, alloc, std::forward< Args >( args )... );
 		}
 
-		// ũο ؼ Ǿ ϴ ԼԴϴ.
+		// memory_resource( 예를 들어 std::pmr::monotonic_buffer_resource )에서 ElementType을 할당하여 생성합니다.
+		template< typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] static NotNull< Type > AllocateNotNull( std::pmr::memory_resource* const resource, Args&&... args )
+		{
+			return AllocateNotNull( std::pmr::polymorphic_allocator< ElementType >( resource ), std::forward< Args >( args )... );
+		}
+
+		// 매크로에 의해서만 실행되어야 하는 함수입니다.
 		[[nodiscard]] static NotNull< Type > DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( const Type& data )
 		{
 			return NotNull< Type >( data );
 		}
 
-		// m_data ȯϴ ԼԴϴ.
-		[[nodiscard]] Type DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() const
+		[[nodiscard]] static NotNull< Type > DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( Type&& data ) noexcept
+		{
+			return NotNull< Type >( std::move( data ) );
+		}
+
+		// m_data를 반환하는 함수입니다.
+		[[nodiscard]] Type DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() const&
 		{
 			return m_data;
 		}
+
+		// 소멸될 NotNull( rvalue )일 경우, m_data를 복사하지 않고 옮겨서 반환합니다.
+		[[nodiscard]] Type DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() && noexcept
+		{
+			return std::move( m_data );
+		}
 	public:
 #pragma endregion
 
 #pragma region [ Operator ]
 		operator ElementType&() const noexcept
 		{
-			return *m_data;
+			assert( !PointerTraits< Type >::IsNull( m_data ) && "use after move" );
+			return PointerTraits< Type >::Deref( m_data );
 		}
 
-		//  Opertator ǵ ٸ, ۵   մϴ.
+		// 위 Opertator이 의도와 다르게, 동작되지 않을 때 사용합니다.
 		ElementType& operator()() const noexcept
 		{
-			return *m_data;
+			assert( !PointerTraits< Type >::IsNull( m_data ) && "use after move" );
+			return PointerTraits< Type >::Deref( m_data );
 		}
 
 		void operator=( const ElementType& ele )
 		{
-			*m_data = ele;
+			assert( !PointerTraits< Type >::IsNull( m_data ) && "use after move" );
+			PointerTraits< Type >::Deref( m_data ) = ele;
 		}
 
-		// operator DataElementType ϱ  operator*()  ʽϴ. 
-		//   Ϳ ȣȯ ʿ䰡 ̱. ε,  Ʈ  ÿ ̿ °  ʿմϴ.
+		// operator DataElementType를 제공하기 때문에 operator*()를 제공하지 않습니다. 
+		// 굳이 기존 포인터와 호환할 필요가 없어보이기. 때문인데, 기존 프로젝트의 적용 시에는 이에 맞게 적용이 필요합니다.
 		// 
 		//DataElementType& operator*() const noexcept
 		//{
 		//	return *m_data;
 		//}
 
-		//  ü ܺη ȯ , Delete  ̿  NotNull ǹ̰ Ǳ  ѵǾϴ.
-		// notnull notnull̿ մϴ.
+		// 포인터 자체를 외부로 반환할 경우, Delete 가능해지고 이에 따라 NotNull의 의미가 퇴색되기 떄문에 제한되었습니다.
+		// notnull은 notnull이여야 합니다.
 		//const DataElementType* const get() const noexcept
 		//{
 		//	if constexpr ( std::is_pointer< DataType >::value )
@@ -186,20 +414,73 @@ namespace WonSY
 	public:
 #pragma endregion
 
+		// T가 TaggedPtr 일 경우, 포인터에 함께 담긴 소유권과 Tag에 접근합니다.
+		bool IsOwner() const noexcept
+			requires IsTaggedPtr< Type >::value
+		{
+			return m_data.IsOwner();
+		}
+
+		template< typename TagType >
+			requires IsTaggedPtr< Type >::value
+		bool HasTag( const TagType tag ) const noexcept
+		{
+			return m_data.HasTag( tag );
+		}
+
+		template< typename TagType >
+			requires IsTaggedPtr< Type >::value
+		void SetTag( const TagType tag, const bool isOn = true ) noexcept
+		{
+			m_data.SetTag( tag, isOn );
+		}
+
 		long GetUseCount() const
 		{
-			if constexpr ( WonSY::IsSharedPtr< Type >::value )
+			if constexpr ( WonSY::IsSharedPtr< Type >::value || WonSY::IsIntrusivePtr< Type >::value || WonSY::IsLocalSharedPtr< Type >::value )
 			{
 				return m_data.use_count();
 			}
+			else if constexpr ( PointerTraitsUseCountable< Type > )
+			{
+				return PointerTraits< Type >::UseCount( m_data );
+			}
 			else
 			{
 				WONSY_FAIL_STATIC_ASSERT( "unSupported Type!" );
 			}
 		}
+
+		// 가리키는 개체의 Identity( 기본적으로 주소 )를 반환합니다. 비교, 해시에서 사용합니다.
+		[[nodiscard]] std::uint64_t GetIdentity() const noexcept
+		{
+			return WonSY::GetIdentity( m_data );
+		}
+
+		// ElementType의 값이 아닌, 가리키는 개체가 같은지 비교합니다.
+		friend bool operator==( const NotNull& lhs, const NotNull& rhs ) noexcept
+		{
+			return lhs.GetIdentity() == rhs.GetIdentity();
+		}
+
+		// 가리키는 개체의 주소 순으로 정렬합니다. ( 주소 순으로 모아서 처리할 때 사용합니다. )
+		friend std::strong_ordering operator<=>( const NotNull& lhs, const NotNull& rhs ) noexcept
+		{
+			return lhs.GetIdentity() <=> rhs.GetIdentity();
+		}
 	};
 }
 
+// unordered_set, unordered_map의 키로 사용할 수 있도록, Identity로 해시합니다.
+template< WonSY::NotNullRequire T >
+struct std::hash< WonSY::NotNull< T > >
+{
+	std::size_t operator()( const WonSY::NotNull< T >& notNull ) const noexcept
+	{
+		return std::hash< std::uint64_t >{}( notNull.GetIdentity() );
+	}
+};
+
 template< typename T >
 using WsyNotNull = WonSY::NotNull< T >;
 
@@ -212,4 +493,19 @@ using WsyNotNullShared = WonSY::NotNull< WsySharedPtr< T > >;
 template< typename T >
 using WsyNotNullUnique = WonSY::NotNull< WsyUniquePtr< T > >;
 
+template< typename T >
+using WsyNotNullUniquePmr = WonSY::NotNull< WsyUniquePtrPmr< T > >;
+
+template< typename T >
+using WsyNotNullInline = WonSY::NotNull< WsyInline< T > >;
+
+template< typename T >
+using WsyNotNullIntrusive = WonSY::NotNull< WsyIntrusivePtr< T > >;
+
+template< typename T >
+using WsyNotNullLocalShared = WonSY::NotNull< WsyLocalSharedPtr< T > >;
+
+template< typename T, typename TagType = std::size_t >
+using WsyNotNullTagged = WonSY::NotNull< WsyTaggedPtr< T, TagType > >;
+
 #endif
@@ -0,0 +1,274 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_NOTNULL_BATCH
+#define WONSY_NOTNULL_BATCH
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_NotNullRef.h"
+
+
+namespace WonSY
+{
+	/*
+		많은 수의 NotNull< shared_ptr< T > >를 한번에 생성하는 Batch입니다.
+
+		MakeNotNullBatch< T >( count, args... )는 count개의 ElementType과 레퍼런스 카운트( 컨트롤 블록 )를 하나의 연속된 메모리 블록에 할당하며,
+		각 ElementType은 args...로 생성됩니다. ( 모든 요소에 같은 인자가 lvalue로 전달됩니다. )
+
+		반환된 Batch에서 꺼낸 NotNull들은 shared_ptr의 aliasing 생성자로 만들어지므로, 추가 할당 없이 블록 전체의 수명을 공유합니다.
+		즉, Batch와 꺼내간 NotNull이 하나라도 남아있다면, 블록 전체가 유지됩니다.
+
+			- operator[], begin() ~ end() : NotNull< shared_ptr< T > >를 반환합니다. ( 레퍼런스 카운트 증가 )
+			- GetRef( index )             : 레퍼런스 카운트 변화 없이 NotNullRef< T >를 반환합니다. ( Batch의 스코프 안에서만 사용해야 합니다. )
+
+		[ Version ]
+		// 0.1
+			- 한번의 할당으로 여러 NotNull을 생성하는 MakeNotNullBatch를 추가하였습니다.
+	*/
+
+	template< typename T >
+	class NotNullBatch
+	{
+	public:
+		using ElementType = T;
+		using Type        = std::shared_ptr< ElementType >;
+
+	private:
+		// 블록의 앞부분에 컨트롤 블록을 위한 공간을 예약하고, 그 뒤에 ElementType들을 배치합니다.
+		static constexpr std::size_t BlockAlign     = std::max( alignof( ElementType ), alignof( std::max_align_t ) );
+		static constexpr std::size_t ControlReserve = ( 128 + alignof( ElementType ) - 1 ) / alignof( ElementType ) * alignof( ElementType );
+
+		// shared_ptr의 컨트롤 블록을 예약된 공간에 할당하고, 컨트롤 블록이 해제될 때 블록 전체를 해제합니다.
+		// ( 컨트롤 블록이 예약된 공간보다 큰 구현일 경우, 컨트롤 블록만 따로 할당합니다. )
+		template< typename U >
+		class BlockAllocator
+		{
+			template< typename V >
+			friend class BlockAllocator;
+
+		public:
+			using value_type = U;
+
+		private:
+			void*       m_block;
+			std::size_t m_blockSize;
+
+		public:
+			BlockAllocator( void* const block, const std::size_t blockSize ) noexcept
+				: m_block    { block     }
+				, m_blockSize{ blockSize }
+			{
+			}
+
+			template< typename V >
+			BlockAllocator( const BlockAllocator< V >& rhs ) noexcept
+				: m_block    { rhs.m_block     }
+				, m_blockSize{ rhs.m_blockSize }
+			{
+			}
+
+			[[nodiscard]] U* allocate( const std::size_t count )
+			{
+				if ( count == 1 && sizeof( U ) <= ControlReserve && alignof( U ) <= BlockAlign ) [[likely]]
+					return static_cast< U* >( m_block );
+
+				return std::allocator< U >{}.allocate( count );
+			}
+
+			void deallocate( U* const ptr, const std::size_t count ) noexcept
+			{
+				if ( static_cast< void* >( ptr ) != m_block ) [[unlikely]]
+					std::allocator< U >{}.deallocate( ptr, count );
+
+				::operator delete( m_block, m_blockSize, std::align_val_t{ BlockAlign } );
+			}
+
+			template< typename V >
+			bool operator==( const BlockAllocator< V >& rhs ) const noexcept
+			{
+				return m_block == rhs.m_block;
+			}
+		};
+
+		// 레퍼런스 카운트가 0이 되면 ElementType들만 소멸시킵니다. 메모리는 컨트롤 블록과 함께 BlockAllocator가 해제합니다.
+		class ElementsDeleter
+		{
+		private:
+			std::size_t m_count;
+
+		public:
+			explicit ElementsDeleter( const std::size_t count ) noexcept
+				: m_count{ count }
+			{
+			}
+
+			void operator()( ElementType* const elements ) const noexcept
+			{
+				std::destroy_n( elements, m_count );
+			}
+		};
+
+	public:
+		class Iterator
+		{
+		public:
+			using iterator_concept  = std::random_access_iterator_tag;
+			using iterator_category = std::input_iterator_tag;
+			using value_type        = NotNull< Type >;
+			using difference_type   = std::ptrdiff_t;
+			using reference         = NotNull< Type >;
+
+		private:
+			const NotNullBatch* m_batch = nullptr;
+			std::size_t         m_index = 0;
+
+		public:
+			Iterator() noexcept = default;
+
+			Iterator( const NotNullBatch* const batch, const std::size_t index ) noexcept
+				: m_batch{ batch }
+				, m_index{ index }
+			{
+			}
+
+			reference operator*() const                                   { return ( *m_batch )[ m_index ]; }
+			reference operator[]( const difference_type offset ) const    { return ( *m_batch )[ m_index + offset ]; }
+
+			Iterator& operator++() noexcept                               { ++m_index; return *this; }
+			Iterator  operator++( int ) noexcept                          { auto prev = *this; ++m_index; return prev; }
+			Iterator& operator--() noexcept                               { --m_index; return *this; }
+			Iterator  operator--( int ) noexcept                          { auto prev = *this; --m_index; return prev; }
+			Iterator& operator+=( const difference_type offset ) noexcept { m_index += offset; return *this; }
+			Iterator& operator-=( const difference_type offset ) noexcept { m_index -= offset; return *this; }
+
+			friend Iterator        operator+( Iterator iter, const difference_type offset ) noexcept { return iter += offset; }
+			friend Iterator        operator+( const difference_type offset, Iterator iter ) noexcept { return iter += offset; }
+			friend Iterator        operator-( Iterator iter, const difference_type offset ) noexcept { return iter -= offset; }
+			friend difference_type operator-( const Iterator& lhs, const Iterator& rhs ) noexcept    { return static_cast< difference_type >( lhs.m_index ) - static_cast< difference_type >( rhs.m_index ); }
+
+			bool                 operator==( const Iterator& rhs ) const noexcept  { return m_index == rhs.m_index; }
+			std::strong_ordering operator<=>( const Iterator& rhs ) const noexcept { return m_index <=> rhs.m_index; }
+		};
+
+	private:
+		Type        m_elements; // 첫번째 ElementType을 가리키며, 블록 전체를 소유합니다.
+		std::size_t m_count;
+
+		NotNullBatch( Type&& elements, const std::size_t count ) noexcept
+			: m_elements{ std::move( elements ) }
+			, m_count   { count                 }
+		{
+		}
+
+	public:
+		NotNullBatch() noexcept
+			: m_elements{ nullptr }
+			, m_count   { 0       }
+		{
+		}
+
+		// count개의 ElementType을 args...로 생성하여, 하나의 블록에 할당합니다.
+		template< typename... Args >
+			requires std::is_constructible_v< ElementType, const Args&... >
+		[[nodiscard]] static NotNullBatch MakeNotNullBatch( const std::size_t count, const Args&... args )
+		{
+			if ( !count )
+				return NotNullBatch{};
+
+			const std::size_t  blockSize = ControlReserve + sizeof( ElementType ) * count;
+			void* const        block     = ::operator new( blockSize, std::align_val_t{ BlockAlign } );
+			ElementType* const elements  = reinterpret_cast< ElementType* >( static_cast< std::byte* >( block ) + ControlReserve );
+
+			std::size_t constructedCount = 0;
+			try
+			{
+				for ( ; constructedCount < count; ++constructedCount )
+					::new ( static_cast< void* >( elements + constructedCount ) ) ElementType( args... );
+			}
+			catch ( ... )
+			{
+				std::destroy_n( elements, constructedCount );
+				::operator delete( block, blockSize, std::align_val_t{ BlockAlign } );
+				throw;
+			}
+
+			try
+			{
+				return NotNullBatch{ Type( elements, ElementsDeleter{ count }, BlockAllocator< ElementType >{ block, blockSize } ), count };
+			}
+			catch ( ... )
+			{
+				// 컨트롤 블록의 할당이 실패한 경우, ElementsDeleter는 이미 호출되었으므로 블록만 해제합니다.
+				::operator delete( block, blockSize, std::align_val_t{ BlockAlign } );
+				throw;
+			}
+		}
+
+		[[nodiscard]] std::size_t size() const noexcept
+		{
+			return m_count;
+		}
+
+		[[nodiscard]] bool empty() const noexcept
+		{
+			return m_count == 0;
+		}
+
+		// index번째 ElementType을 가리키는 NotNull을 반환합니다. ( 추가 할당 없이, 블록의 레퍼런스 카운트만 증가합니다. )
+		[[nodiscard]] NotNull< Type > operator[]( const std::size_t index ) const
+		{
+			assert( index < m_count && "out of range" );
+			return NotNull< Type >::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( Type( m_elements, m_elements.get() + index ) );
+		}
+
+		// index번째 ElementType을 레퍼런스 카운트 변화 없이 빌려옵니다.
+		[[nodiscard]] NotNullRef< ElementType > GetRef( const std::size_t index ) const noexcept
+		{
+			assert( index < m_count && "out of range" );
+			return NotNullRef< ElementType >::DoNotCall_____MY_NAME_IS_NOT_NULL_REF__NICE_TO_MEET_YOU( m_elements.get()[ index ] );
+		}
+
+		[[nodiscard]] Iterator begin() const noexcept
+		{
+			return Iterator{ this, 0 };
+		}
+
+		[[nodiscard]] Iterator end() const noexcept
+		{
+			return Iterator{ this, m_count };
+		}
+
+		// Batch와 꺼내간 NotNull들이 공유하는 블록의 레퍼런스 카운트입니다.
+		[[nodiscard]] long GetUseCount() const noexcept
+		{
+			return m_elements.use_count();
+		}
+	};
+
+	template< typename T, typename... Args >
+		requires std::is_constructible_v< T, const Args&... >
+	[[nodiscard]] NotNullBatch< T > MakeNotNullBatch( const std::size_t count, const Args&... args )
+	{
+		return NotNullBatch< T >::MakeNotNullBatch( count, args... );
+	}
+}
+
+template< typename T >
+using WsyNotNullBatch = WonSY::NotNullBatch< T >;
+
+#endif
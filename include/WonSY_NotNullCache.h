@@ -0,0 +1,270 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_NOTNULL_CACHE
+#define WONSY_NOTNULL_CACHE
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_NotNullRef.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		[예제C]의 Get( Nullable 반환 ), Acquire( NotNull 반환, 없으면 생성 ) 패턴을 여러 스레드에서 사용할 수 있도록 제공하는 NotNullCache입니다.
+
+		하나의 mutex로 보호되는 map은 읽기만 하는 스레드들끼리도 경합하게 됩니다.
+		NotNullCache는 Key의 해시로 나뉜 ShardCount개의 shard마다 shared_mutex와 unordered_map을 가지며, 읽기( Get )는 shared lock만 사용합니다.
+
+			- Get( key )                   : 있으면 해당 요소를, 없으면 null을 반환합니다. ( Nullable< shared_ptr< T > > )
+			- Acquire( key, args... )      : 없으면 T( args... )로 생성하여 반환합니다. ( NotNull< shared_ptr< T > > )
+			- AcquireWith( key, factory )  : 없으면 factory( key )의 결과( NotNull< shared_ptr< T > > )를 담아 반환합니다.
+			- 같은 key로 여러 스레드가 동시에 Acquire하더라도, 생성은 한 번만 일어나며 나머지 스레드는 생성된 요소를 기다려 받습니다.
+			- 생성은 shard의 lock 밖에서 이루어지므로, 오래 걸리는 생성이 다른 key의 Get, Acquire를 막지 않습니다.
+			- 생성 중 예외가 발생하면 예외는 호출한 스레드로 전달되며, 기다리던( 혹은 이후의 ) Acquire 중 하나가 다시 생성을 시도합니다.
+			- Erase, EraseIf, EvictUnused( 캐시 외에 참조하는 곳이 없는 요소 )로 요소를 제거할 수 있습니다.
+
+		주의 해야할 것은,
+			- 제거는 캐시에서 빠지는 것이며, 이미 반환된 NotNull들은 계속 유효합니다.
+			- 생성 중인 key를 제거하면, 생성을 기다리던 Acquire들은 캐시에 남지 않는 요소를 받습니다.
+			- factory, EraseIf의 pred 안에서 같은 NotNullCache에 접근하지 마세요. ( pred는 shard의 lock을 잡은 상태로 호출됩니다. )
+			- size()는 생성 중인 요소를 포함하며, 다른 스레드의 변경과 동시에 호출될 경우 근사값입니다.
+
+		[ Version ]
+		// 0.1
+			- 하나의 전역 mutex로 보호되던 Get, Acquire 레지스트리를 대체하기 위해, shard로 나뉜 NotNullCache를 추가하였습니다.
+	*/
+
+	template< typename Key, typename T, typename Hash = std::hash< Key >, std::size_t ShardCount = 16 >
+	class NotNullCache
+	{
+		static_assert( std::has_single_bit( ShardCount ), "ShardCount must be a power of two." );
+
+	public:
+		using KeyType      = Key;
+		using ElementType  = T;
+		using Type         = std::shared_ptr< ElementType >;
+		using NotNullType  = NotNull< Type >;
+		using NullableType = Nullable< Type >;
+
+	private:
+		// key별로 한 번만 생성하기 위한 노드입니다. 생성이 끝나면( isReady ) value는 null이 아니며, 더 이상 바뀌지 않습니다.
+		class Node
+		{
+		public:
+			std::mutex          createMutex;
+			std::atomic< bool > isReady{ false };
+			Type                value;
+		};
+
+		using NodePtr = std::shared_ptr< Node >;
+
+		// shard 간 false sharing을 피하기 위해, 캐시 라인 단위로 정렬합니다.
+		class alignas( 64 ) Shard
+		{
+		public:
+			mutable std::shared_mutex                    mutex;
+			std::unordered_map< KeyType, NodePtr, Hash > map;
+		};
+
+		Shard m_shards[ ShardCount ];
+
+		[[nodiscard]] static std::size_t _GetShardIndex( const KeyType& key ) noexcept
+		{
+			if constexpr ( ShardCount == 1 )
+			{
+				return 0;
+			}
+			else
+			{
+				// map에서도 같은 해시의 하위 비트를 사용하므로, 섞어서 상위 비트로 shard를 고릅니다.
+				constexpr std::uint32_t shift = 64 - static_cast< std::uint32_t >( std::countr_zero( ShardCount ) );
+
+				const std::uint64_t hash = static_cast< std::uint64_t >( Hash{}( key ) );
+				return static_cast< std::size_t >( ( hash * 0x9E3779B97F4A7C15ull ) >> shift );
+			}
+		}
+
+		// key의 노드를 찾거나, 없다면 생성 전의 노드를 추가합니다.
+		[[nodiscard]] NodePtr _FindOrAddNode( const KeyType& key )
+		{
+			Shard& shard = m_shards[ _GetShardIndex( key ) ];
+
+			{
+				std::shared_lock lock( shard.mutex );
+				if ( const auto iter = shard.map.find( key ); iter != shard.map.end() )
+					return iter->second;
+			}
+
+			std::unique_lock lock( shard.mutex );
+			auto [ iter, isInserted ] = shard.map.try_emplace( key, nullptr );
+			if ( isInserted )
+			{
+				try
+				{
+					iter->second = std::make_shared< Node >();
+				}
+				catch ( ... )
+				{
+					shard.map.erase( iter );
+					throw;
+				}
+			}
+
+			return iter->second;
+		}
+
+		template< typename Factory >
+		[[nodiscard]] NotNullType _Acquire( const KeyType& key, Factory&& factory )
+		{
+			// Acquire도 우선 Get으로 확인합니다.
+			if ( NullableType nullable = Get( key ) )
+				return std::move( nullable ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__TAKE_MY_NAME();
+
+			const NodePtr node = _FindOrAddNode( key );
+
+			// 같은 노드의 생성은 한 스레드에서만 실행되며, 나머지는 생성이 끝날 때까지 기다립니다.
+			// ( std::call_once는 예외 발생 시 기다리던 스레드가 깨어나지 못하는 구현이 있어, 노드의 mutex로 처리합니다. )
+			if ( !node->isReady.load( std::memory_order_acquire ) )
+			{
+				std::lock_guard lock( node->createMutex );
+				if ( !node->isReady.load( std::memory_order_relaxed ) )
+				{
+					node->value = std::forward< Factory >( factory )().DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD();
+					node->isReady.store( true, std::memory_order_release );
+				}
+			}
+
+			return NotNullType::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( node->value );
+		}
+
+	public:
+		NotNullCache() = default;
+
+		NotNullCache( const NotNullCache& )            = delete;
+		NotNullCache& operator=( const NotNullCache& ) = delete;
+
+		// key의 요소가 있으면 해당 요소를, 없거나 아직 생성 중이라면 null을 반환합니다.
+		[[nodiscard]] NullableType Get( const KeyType& key ) const
+		{
+			const Shard& shard = m_shards[ _GetShardIndex( key ) ];
+
+			std::shared_lock lock( shard.mutex );
+			if ( const auto iter = shard.map.find( key ); iter != shard.map.end() && iter->second->isReady.load( std::memory_order_acquire ) )
+				return NullableType( iter->second->value );
+
+			return nullptr;
+		}
+
+		// key의 요소가 없다면, ElementType( args... )로 생성하여 반환합니다.
+		template< typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] NotNullType Acquire( const KeyType& key, Args&&... args )
+		{
+			return _Acquire( key, [ & ]() { return NotNullType::EmplaceNotNull( std::forward< Args >( args )... ); } );
+		}
+
+		// key의 요소가 없다면, factory( key )가 반환한 NotNull< shared_ptr< T > >을 담아 반환합니다.
+		template< typename Factory >
+			requires std::is_convertible_v< std::invoke_result_t< Factory&&, const KeyType& >, NotNullType >
+		[[nodiscard]] NotNullType AcquireWith( const KeyType& key, Factory&& factory )
+		{
+			return _Acquire( key, [ & ]() -> NotNullType { return std::invoke( std::forward< Factory >( factory ), key ); } );
+		}
+
+		bool Erase( const KeyType& key )
+		{
+			Shard& shard = m_shards[ _GetShardIndex( key ) ];
+
+			std::unique_lock lock( shard.mutex );
+			return shard.map.erase( key ) != 0;
+		}
+
+		// pred( const KeyType&, NotNullRef< ElementType > )가 true인 요소들을 제거하고, 제거된 수를 반환합니다. ( 생성 중인 요소는 제외합니다. )
+		template< typename Pred >
+		std::size_t EraseIf( Pred&& pred )
+		{
+			std::size_t erasedCount = 0;
+
+			for ( Shard& shard : m_shards )
+			{
+				std::unique_lock lock( shard.mutex );
+				erasedCount += std::erase_if( shard.map, [ &pred ]( const auto& pair )
+					{
+						const Node& node = *pair.second;
+						if ( !node.isReady.load( std::memory_order_acquire ) )
+							return false;
+
+						return static_cast< bool >( pred( pair.first, NotNullRef< ElementType >::DoNotCall_____MY_NAME_IS_NOT_NULL_REF__NICE_TO_MEET_YOU( *node.value ) ) );
+					} );
+			}
+
+			return erasedCount;
+		}
+
+		// 캐시 외에 참조하는 곳이 없는 요소들을 제거하고, 제거된 수를 반환합니다.
+		std::size_t EvictUnused()
+		{
+			std::size_t erasedCount = 0;
+
+			for ( Shard& shard : m_shards )
+			{
+				std::unique_lock lock( shard.mutex );
+				erasedCount += std::erase_if( shard.map, []( const auto& pair )
+					{
+						const Node& node = *pair.second;
+						return node.isReady.load( std::memory_order_acquire ) && node.value.use_count() == 1;
+					} );
+			}
+
+			return erasedCount;
+		}
+
+		void Clear()
+		{
+			for ( Shard& shard : m_shards )
+			{
+				std::unique_lock lock( shard.mutex );
+				shard.map.clear();
+			}
+		}
+
+		[[nodiscard]] std::size_t size() const
+		{
+			std::size_t count = 0;
+
+			for ( const Shard& shard : m_shards )
+			{
+				std::shared_lock lock( shard.mutex );
+				count += shard.map.size();
+			}
+
+			return count;
+		}
+	};
+}
+
+template< typename Key, typename T, typename Hash = std::hash< Key >, std::size_t ShardCount = 16 >
+using WsyNotNullCache = WonSY::NotNullCache< Key, T, Hash, ShardCount >;
+
+#endif
@@ -0,0 +1,332 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_NOT_NULL_FLAT_MAP
+#define WONSY_NOT_NULL_FLAT_MAP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_NotNullRef.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull< Type >을 키로 사용하는, 오픈 어드레싱( 선형 탐사 ) 방식의 NotNullFlatMap, NotNullFlatSet입니다.
+
+		unordered_map, unordered_set은 요소마다 노드를 할당하고, 탐색 시 포인터를 따라가며 캐시 미스가 발생합니다.
+		NotNullFlatMap은 하나의 배열에 Type( 포인터 )과 Value를 빈틈 없이 담으며, 키는 NotNull이므로 null을 빈 slot으로 사용합니다.
+
+			- 키의 비교와 해시는 NotNull의 Identity( 기본적으로 주소 )로 처리합니다.
+			- 해시는 Identity에 황금비 상수를 곱하여 상위 비트를 사용합니다. ( 정렬로 인해 비어있는 포인터의 하위 비트를 피합니다. )
+			- 제거 시 뒤의 요소들을 당겨오므로( backward shift ), 삭제 표시( tombstone )가 남지 않습니다.
+			- 탐색( Find )은 Nullable< Value* >를 반환합니다.
+
+		주의 해야할 것은,
+			- 생성, 제거 시 요소들이 이동되므로, Find로 얻은 Value*는 같은 컨테이너에 생성, 제거가 일어나기 전까지만 사용해야 합니다.
+			- Inline< T >은 복사본마다 Identity가 다르므로, 키로 사용할 수 없습니다.
+
+		[ Version ]
+		// 0.1
+			- 엔티티 포인터를 키로 하는 컨테이너의 노드 할당 비용을 피하기 위해, NotNullFlatMap, NotNullFlatSet을 추가하였습니다.
+	*/
+
+	template < typename Type >
+	concept NotNullFlatKeyType = NotNullRequire< Type > && !IsInline< Type >::value && std::constructible_from< Type, std::nullptr_t >;
+
+	template < NotNullFlatKeyType Type, std::default_initializable Value >
+	class NotNullFlatMap
+	{
+	public:
+		using KeyType     = NotNull< Type >;
+		using ElementType = WsyElementType< Type >::Type;
+
+	private:
+		class Slot
+		{
+		public:
+			Type                        key{ nullptr };
+			[[no_unique_address]] Value value{};
+		};
+
+		static constexpr std::size_t MinCapacity = 16;
+
+		std::vector< Slot > m_slots;
+		std::size_t         m_size  = 0;
+		std::uint32_t       m_shift = 64;
+
+		[[nodiscard]] static bool _IsEmpty( const Slot& slot ) noexcept
+		{
+			return GetIdentity( slot.key ) == 0;
+		}
+
+		[[nodiscard]] std::size_t _GetMask() const noexcept
+		{
+			return m_slots.size() - 1;
+		}
+
+		[[nodiscard]] std::size_t _GetHomeIndex( const std::uint64_t identity ) const noexcept
+		{
+			return static_cast< std::size_t >( ( identity * 0x9E3779B97F4A7C15ull ) >> m_shift );
+		}
+
+		// 찾은 경우 그 slot의, 아니라면 들어갈 빈 slot의 인덱스를 반환합니다.
+		[[nodiscard]] std::size_t _Probe( const std::uint64_t identity ) const noexcept
+		{
+			const std::size_t mask = _GetMask();
+
+			for ( std::size_t index = _GetHomeIndex( identity ); ; index = ( index + 1 ) & mask )
+			{
+				const std::uint64_t slotIdentity = GetIdentity( m_slots[ index ].key );
+				if ( slotIdentity == identity || slotIdentity == 0 )
+					return index;
+			}
+		}
+
+		void _Rehash( const std::size_t capacity )
+		{
+			std::vector< Slot > oldSlots = std::exchange( m_slots, std::vector< Slot >( capacity ) );
+			m_shift = 64 - static_cast< std::uint32_t >( std::countr_zero( capacity ) );
+
+			for ( Slot& slot : oldSlots )
+			{
+				if ( !_IsEmpty( slot ) )
+					m_slots[ _Probe( GetIdentity( slot.key ) ) ] = std::move( slot );
+			}
+		}
+
+		// 빈 slot이 항상 남도록, 3 / 4 이상 차기 전에 늘립니다.
+		void _ReserveForInsert()
+		{
+			if ( ( m_size + 1 ) * 4 > m_slots.size() * 3 )
+				_Rehash( m_slots.empty() ? MinCapacity : m_slots.size() * 2 );
+		}
+
+		template< typename KeyArg, typename... Args >
+		std::pair< Value&, bool > _TryEmplace( KeyArg&& key, Args&&... args )
+		{
+			const std::uint64_t identity = key.GetIdentity();
+			if ( !m_slots.empty() )
+			{
+				if ( Slot& slot = m_slots[ _Probe( identity ) ]; !_IsEmpty( slot ) )
+					return { slot.value, false };
+			}
+
+			_ReserveForInsert();
+
+			Slot& slot = m_slots[ _Probe( identity ) ];
+			slot.value = Value( std::forward< Args >( args )... );
+			slot.key   = std::forward< KeyArg >( key ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD();
+			++m_size;
+
+			return { slot.value, true };
+		}
+
+	public:
+		NotNullFlatMap() = default;
+
+		[[nodiscard]] std::size_t size() const noexcept
+		{
+			return m_size;
+		}
+
+		[[nodiscard]] bool empty() const noexcept
+		{
+			return m_size == 0;
+		}
+
+		void Reserve( const std::size_t count )
+		{
+			const std::size_t capacity = std::bit_ceil( std::max( MinCapacity, ( count * 4 + 2 ) / 3 ) );
+			if ( capacity > m_slots.size() )
+				_Rehash( capacity );
+		}
+
+		void Clear() noexcept
+		{
+			m_slots.clear();
+			m_size  = 0;
+			m_shift = 64;
+		}
+
+		// key가 없다면 args로 Value를 생성합니다. ( Value&, 생성 여부 )를 반환합니다.
+		template< typename... Args >
+			requires std::is_constructible_v< Value, Args&&... >
+		std::pair< Value&, bool > TryEmplace( const KeyType& key, Args&&... args )
+		{
+			return _TryEmplace( key, std::forward< Args >( args )... );
+		}
+
+		template< typename... Args >
+			requires std::is_constructible_v< Value, Args&&... >
+		std::pair< Value&, bool > TryEmplace( KeyType&& key, Args&&... args )
+		{
+			return _TryEmplace( std::move( key ), std::forward< Args >( args )... );
+		}
+
+		Value& operator[]( const KeyType& key )
+		{
+			return TryEmplace( key ).first;
+		}
+
+		[[nodiscard]] bool Contains( const KeyType& key ) const noexcept
+		{
+			return Find( key );
+		}
+
+		// key가 없다면 null인 Nullable을 반환합니다.
+		[[nodiscard]] Nullable< Value* > Find( const KeyType& key ) noexcept
+		{
+			if ( m_slots.empty() )
+				return nullptr;
+
+			Slot& slot = m_slots[ _Probe( key.GetIdentity() ) ];
+			return _IsEmpty( slot ) ? nullptr : &slot.value;
+		}
+
+		[[nodiscard]] Nullable< const Value* > Find( const KeyType& key ) const noexcept
+		{
+			if ( m_slots.empty() )
+				return nullptr;
+
+			const Slot& slot = m_slots[ _Probe( key.GetIdentity() ) ];
+			return _IsEmpty( slot ) ? nullptr : &slot.value;
+		}
+
+		bool Erase( const KeyType& key ) noexcept
+		{
+			if ( m_slots.empty() )
+				return false;
+
+			const std::size_t mask = _GetMask();
+
+			std::size_t hole = _Probe( key.GetIdentity() );
+			if ( _IsEmpty( m_slots[ hole ] ) )
+				return false;
+
+			// 빈 자리( hole )보다 뒤에 있지만 hole에 들어갈 수 있었던 요소들을 당겨옵니다.
+			for ( std::size_t index = ( hole + 1 ) & mask; !_IsEmpty( m_slots[ index ] ); index = ( index + 1 ) & mask )
+			{
+				const std::size_t home = _GetHomeIndex( GetIdentity( m_slots[ index ].key ) );
+				if ( ( ( index - home ) & mask ) >= ( ( index - hole ) & mask ) )
+				{
+					m_slots[ hole ] = std::move( m_slots[ index ] );
+					hole            = index;
+				}
+			}
+
+			m_slots[ hole ] = Slot{};
+			--m_size;
+
+			return true;
+		}
+
+		// 모든 요소에 대해 func( NotNullRef< ElementType >, Value& )를 호출합니다. ( 순서는 정해져 있지 않습니다. )
+		template< typename Func >
+		void ForEach( Func&& func )
+		{
+			for ( Slot& slot : m_slots )
+			{
+				if ( !_IsEmpty( slot ) )
+					func( NotNullRef< ElementType >::DoNotCall_____MY_NAME_IS_NOT_NULL_REF__NICE_TO_MEET_YOU( PointerTraits< Type >::Deref( slot.key ) ), slot.value );
+			}
+		}
+
+		template< typename Func >
+		void ForEach( Func&& func ) const
+		{
+			for ( const Slot& slot : m_slots )
+			{
+				if ( !_IsEmpty( slot ) )
+					func( NotNullRef< ElementType >::DoNotCall_____MY_NAME_IS_NOT_NULL_REF__NICE_TO_MEET_YOU( PointerTraits< Type >::Deref( slot.key ) ), slot.value );
+			}
+		}
+	};
+
+	template < NotNullFlatKeyType Type >
+	class NotNullFlatSet
+	{
+	public:
+		using KeyType     = NotNull< Type >;
+		using ElementType = WsyElementType< Type >::Type;
+
+	private:
+		class EmptyValue
+		{
+		};
+
+		NotNullFlatMap< Type, EmptyValue > m_map;
+
+	public:
+		[[nodiscard]] std::size_t size() const noexcept
+		{
+			return m_map.size();
+		}
+
+		[[nodiscard]] bool empty() const noexcept
+		{
+			return m_map.empty();
+		}
+
+		void Reserve( const std::size_t count )
+		{
+			m_map.Reserve( count );
+		}
+
+		void Clear() noexcept
+		{
+			m_map.Clear();
+		}
+
+		// 새로 추가된 경우 true를 반환합니다.
+		bool Insert( const KeyType& key )
+		{
+			return m_map.TryEmplace( key ).second;
+		}
+
+		bool Insert( KeyType&& key )
+		{
+			return m_map.TryEmplace( std::move( key ) ).second;
+		}
+
+		[[nodiscard]] bool Contains( const KeyType& key ) const noexcept
+		{
+			return m_map.Contains( key );
+		}
+
+		bool Erase( const KeyType& key ) noexcept
+		{
+			return m_map.Erase( key );
+		}
+
+		// 모든 요소에 대해 func( NotNullRef< ElementType > )를 호출합니다. ( 순서는 정해져 있지 않습니다. )
+		template< typename Func >
+		void ForEach( Func&& func ) const
+		{
+			m_map.ForEach( [ &func ]( const NotNullRef< ElementType > element, const EmptyValue& ) { func( element ); } );
+		}
+	};
+}
+
+template< typename Type, typename Value >
+using WsyNotNullFlatMap = WonSY::NotNullFlatMap< Type, Value >;
+
+template< typename Type >
+using WsyNotNullFlatSet = WonSY::NotNullFlatSet< Type >;
+
+#endif
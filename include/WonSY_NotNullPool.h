@@ -0,0 +1,275 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_NOTNULL_POOL
+#define WONSY_NOTNULL_POOL
+
+#include <algorithm>
+#include <memory>
+#include <new>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		같은 타입의 짧게 살고 사라지는 개체들을 위한 Pool입니다.
+
+		NotNull< shared_ptr< T > >( 혹은 Nullable )을 반환하지만, 컨트롤 블록과 ElementType이 함께 들어가는 메모리 블록을
+		스레드별 FreeList에서 꺼내오고, 마지막 참조가 사라지면 ElementType을 소멸시킨 후 블록을 다시 FreeList로 돌려줍니다.
+		따라서 재사용되는 경우( hit ), 힙 할당 없이 포인터를 꺼내고 넣는 것으로 처리됩니다.
+
+			- FreeList는 스레드별로 존재하며, 블록은 해제되는 스레드의 FreeList로 돌아갑니다.
+			- 스레드별 FreeList가 MaxCachedCount보다 많아지면, 이후 블록은 힙으로 돌려줍니다.
+			- 통계( GetStats ) 또한 스레드별로 집계되며, 호출한 스레드의 통계를 반환합니다.
+			  ( 다른 스레드에서 해제된 개체는 해제한 스레드의 liveCount에서 빠지므로, 스레드에 한정된 개체들에 대해 정확합니다. )
+
+		[ Version ]
+		// 0.1
+			- AcquireNotNull, AcquireNullable, GetStats, Trim 추가하였습니다.
+	*/
+
+	template< typename T, std::size_t MaxCachedCount = 1024 >
+	class NotNullPool
+	{
+	public:
+		using ElementType = T;
+		using Type        = std::shared_ptr< ElementType >;
+
+		struct Stats
+		{
+			std::size_t hitCount      = 0; // FreeList에서 블록을 꺼내온 횟수
+			std::size_t missCount     = 0; // FreeList가 비어서 힙에서 할당한 횟수
+			std::size_t liveCount     = 0; // 현재 살아있는 개체 수
+			std::size_t highWaterMark = 0; // liveCount의 최대값
+			std::size_t cachedCount   = 0; // 현재 FreeList에 들어있는 블록 수
+		};
+
+	private:
+		struct FreeNode
+		{
+			FreeNode* next;
+		};
+
+		// 스레드별 통계와, 해당 스레드의 FreeList를 비우는 함수입니다. 블록 타입과 관계 없이 T 단위로 존재합니다.
+		struct ThreadContext
+		{
+			Stats stats;
+			void  ( *trimFunc )() noexcept = nullptr;
+		};
+
+		static ThreadContext& _GetThreadContext() noexcept
+		{
+			thread_local ThreadContext s_context;
+			return s_context;
+		}
+
+		static Stats& _GetThreadStats() noexcept
+		{
+			return _GetThreadContext().stats;
+		}
+
+		// 스레드별 FreeList입니다. allocate_shared가 rebind한 블록 타입( Block )마다 하나씩 존재합니다.
+		template< typename Block >
+		class ThreadCache
+		{
+		public:
+			static constexpr std::size_t BlockSize  = std::max( sizeof( Block ), sizeof( FreeNode ) );
+			static constexpr std::size_t BlockAlign = std::max( alignof( Block ), alignof( FreeNode ) );
+
+		private:
+			FreeNode* m_head = nullptr;
+
+			// 스레드 종료 시 캐시가 먼저 소멸된 이후에도, 다른 thread_local 개체의 소멸에서 블록이 돌아올 수 있습니다.
+			static bool& _IsDestroyed() noexcept
+			{
+				thread_local bool s_isDestroyed = false;
+				return s_isDestroyed;
+			}
+
+		public:
+			ThreadCache() noexcept
+			{
+				_GetThreadContext().trimFunc = []() noexcept
+					{
+						if ( ThreadCache* const cache = Get() )
+							cache->Trim();
+					};
+			}
+
+			~ThreadCache()
+			{
+				_IsDestroyed() = true;
+				_GetThreadContext().trimFunc = nullptr;
+				Trim();
+			}
+
+			static ThreadCache* Get() noexcept
+			{
+				if ( _IsDestroyed() ) [[unlikely]]
+					return nullptr;
+
+				thread_local ThreadCache s_cache;
+				return &s_cache;
+			}
+
+			static void* AllocateFromHeap()
+			{
+				return ::operator new( BlockSize, std::align_val_t{ BlockAlign } );
+			}
+
+			static void DeallocateToHeap( void* const block ) noexcept
+			{
+				::operator delete( block, BlockSize, std::align_val_t{ BlockAlign } );
+			}
+
+			void* Pop()
+			{
+				Stats& stats = _GetThreadStats();
+
+				void* block = nullptr;
+				if ( m_head )
+				{
+					block  = std::exchange( m_head, m_head->next );
+					--stats.cachedCount;
+					++stats.hitCount;
+				}
+				else
+				{
+					block = AllocateFromHeap();
+					++stats.missCount;
+				}
+
+				stats.highWaterMark = std::max( stats.highWaterMark, ++stats.liveCount );
+				return block;
+			}
+
+			void Push( void* const block ) noexcept
+			{
+				Stats& stats = _GetThreadStats();
+
+				if ( stats.liveCount )
+					--stats.liveCount;
+
+				if ( stats.cachedCount >= MaxCachedCount )
+				{
+					DeallocateToHeap( block );
+					return;
+				}
+
+				m_head = ::new ( block ) FreeNode{ m_head };
+				++stats.cachedCount;
+			}
+
+			void Trim() noexcept
+			{
+				while ( m_head )
+				{
+					DeallocateToHeap( std::exchange( m_head, m_head->next ) );
+					--_GetThreadStats().cachedCount;
+				}
+			}
+		};
+
+	public:
+		// allocate_shared에 전달되는 Allocator입니다. 블록 하나씩의 할당만 FreeList를 사용합니다.
+		template< typename U >
+		class Allocator
+		{
+		public:
+			using value_type = U;
+
+			template< typename V >
+			struct rebind
+			{
+				using other = Allocator< V >;
+			};
+
+			Allocator() noexcept = default;
+
+			template< typename V >
+			Allocator( const Allocator< V >& ) noexcept
+			{
+			}
+
+			[[nodiscard]] U* allocate( const std::size_t count )
+			{
+				if ( count != 1 ) [[unlikely]]
+					return std::allocator< U >{}.allocate( count );
+
+				if ( ThreadCache< U >* const cache = ThreadCache< U >::Get() ) [[likely]]
+					return static_cast< U* >( cache->Pop() );
+
+				return static_cast< U* >( ThreadCache< U >::AllocateFromHeap() );
+			}
+
+			void deallocate( U* const ptr, const std::size_t count ) noexcept
+			{
+				if ( count != 1 ) [[unlikely]]
+				{
+					std::allocator< U >{}.deallocate( ptr, count );
+					return;
+				}
+
+				if ( ThreadCache< U >* const cache = ThreadCache< U >::Get() ) [[likely]]
+				{
+					cache->Push( ptr );
+					return;
+				}
+
+				ThreadCache< U >::DeallocateToHeap( ptr );
+			}
+
+			template< typename V >
+			bool operator==( const Allocator< V >& ) const noexcept
+			{
+				return true;
+			}
+		};
+
+	public:
+		NotNullPool() = delete;
+
+		// Pool에서 블록을 꺼내와 ElementType을 제자리에서 생성합니다.
+		template< typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] static NotNull< Type > AcquireNotNull( Args&&... args )
+		{
+			return NotNull< Type >::AllocateNotNull( Allocator< ElementType >{}, std::forward< Args >( args )... );
+		}
+
+		template< typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] static Nullable< Type > AcquireNullable( Args&&... args )
+		{
+			return Nullable< Type >::AllocateNullable( Allocator< ElementType >{}, std::forward< Args >( args )... );
+		}
+
+		// 호출한 스레드의 통계를 반환합니다.
+		[[nodiscard]] static Stats GetStats() noexcept
+		{
+			return _GetThreadStats();
+		}
+
+		// 호출한 스레드의 FreeList에 남아있는 블록들을 힙으로 돌려줍니다.
+		static void Trim() noexcept
+		{
+			if ( const auto trimFunc = _GetThreadContext().trimFunc )
+				trimFunc();
+		}
+	};
+}
+
+template< typename T, std::size_t MaxCachedCount = 1024 >
+using WsyNotNullPool = WonSY::NotNullPool< T, MaxCachedCount >;
+
+#endif
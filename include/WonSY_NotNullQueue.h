@@ -0,0 +1,270 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_NOTNULL_QUEUE
+#define WONSY_NOTNULL_QUEUE
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull< Type >( 주로 NotNull< unique_ptr< T > > )을 스레드 간에 옮기는, 크기가 고정된 lock-free MPMC( 여러 생산자, 여러 소비자 ) 큐입니다.
+
+		작업들을 unique_ptr로 옮기면, 꺼내는 스레드마다 null 확인이 필요합니다.
+		NotNullQueue는 NotNull만 넣을 수 있으므로, 꺼낸 요소는 다시 확인할 필요 없이 NotNull로 사용할 수 있습니다.
+
+			- slot마다 순번( sequence )을 가지는 방식( Dmitry Vyukov의 bounded MPMC queue )으로, mutex 없이 CAS로 위치를 얻습니다.
+			- TryPushBatch, TryPopBatch는 연속된 여러 slot을 CAS 한 번으로 얻으므로, 요소 단위로 넣고 꺼내는 것보다 경합이 적습니다.
+			- 생산자의 위치와 소비자의 위치는 서로 다른 캐시 라인에 두어, false sharing을 피합니다.
+			- 넣기에 실패한 경우( 가득 참 ) 인자로 받은 NotNull은 옮겨지지 않고 그대로 유지됩니다.
+			- TryPop은 비어있을 경우 null인 Nullable을 반환합니다. ( EXPAND_TO_NOTNULL_MOVE로 확장합니다. )
+
+		주의 해야할 것은,
+			- 용량은 2의 거듭제곱으로 올림되며, 생성 이후 바뀌지 않습니다.
+			- TryPushBatch는 앞에서부터 넣은 수를 반환하며, 넣은 요소들은 옮겨진( use after move ) 상태가 됩니다.
+			- 꺼낸 요소를 잃어버리지 않도록, TryPopBatch( out, maxCount )의 out은 예외가 발생하지 않는 출력 반복자( Nullable의 배열 등 )만 받습니다.
+			  std::vector 등 컨테이너에 넣을 때는 TryPopBatch( container, maxCount )를 사용하며, slot을 얻기 전에 미리 reserve합니다.
+			- 생산자가 slot을 얻은 후 요소를 채우기 전까지, 그 뒤의 요소들도 꺼낼 수 없습니다. ( 잠깐 비어있는 것으로 보일 수 있습니다. )
+
+		[ Version ]
+		// 0.1
+			- mutex로 보호되던 작업 deque를 대체하기 위해, NotNull을 옮기는 lock-free MPMC NotNullQueue를 추가하였습니다.
+
+		// 0.2
+			- 빈 range의 TryPushBatch, maxCount가 0인 TryPopBatch가 반환되지 않던 문제를 수정하였습니다.
+
+		// 0.3
+			- TryPopBatch의 out에서 예외가 발생하면 꺼낸 요소들이 해제되던 문제를 수정하였습니다.
+			  out은 예외가 발생하지 않는 출력 반복자로 제한하며, 컨테이너에 넣는 TryPopBatch( container, maxCount )를 추가하였습니다.
+	*/
+
+	template < typename Type >
+	concept NotNullQueueType = NotNullRequire< Type > && std::is_nothrow_move_constructible_v< Type > && std::is_nothrow_move_assignable_v< Type > && std::constructible_from< Type, std::nullptr_t >;
+
+	// TryPopBatch에서 꺼낸 요소를 잃어버리지 않도록, 넣기와 증가에서 예외가 발생하지 않는 출력 반복자입니다.
+	template < typename Out, typename Type >
+	concept NothrowOutputIterator = std::output_iterator< Out, Type > && requires( Out& out, Type&& value )
+	{
+		{ *out = std::move( value ) } noexcept;
+		{ ++out } noexcept;
+	};
+
+	// reserve한 capacity 안에서는 push_back이 할당하지 않는 컨테이너입니다. ( std::vector 등 )
+	template < typename Container, typename Type >
+	concept ReservableContainer = requires( Container& container, const std::size_t count, Type&& value )
+	{
+		container.reserve( count );
+		{ container.size() } -> std::convertible_to< std::size_t >;
+		{ container.capacity() } -> std::convertible_to< std::size_t >;
+		container.push_back( std::move( value ) );
+	};
+
+	template< NotNullQueueType _Type >
+	class NotNullQueue
+	{
+	public:
+		using Type         = _Type;
+		using ElementType  = WsyElementType< _Type >::Type;
+		using NotNullType  = NotNull< Type >;
+		using NullableType = Nullable< Type >;
+
+		static constexpr std::size_t CacheLineSize = 64;
+
+	private:
+		// 생산자는 sequence가 위치와 같을 때 채우고 위치 + 1로, 소비자는 위치 + 1일 때 꺼내고 위치 + 용량으로 바꿉니다.
+		class Cell
+		{
+		public:
+			std::atomic< std::size_t > sequence{ 0 };
+			Type                       data{ nullptr };
+		};
+
+		class Claim
+		{
+		public:
+			std::size_t position;
+			std::size_t count;
+		};
+
+		const std::size_t         m_mask;
+		std::unique_ptr< Cell[] > m_cells;
+
+		// 읽기만 하는 위 멤버들, 그리고 서로와 캐시 라인을 공유하지 않도록 정렬합니다. ( 클래스의 크기도 캐시 라인 단위가 됩니다. )
+		alignas( CacheLineSize ) std::atomic< std::size_t > m_enqueuePosition{ 0 };
+		alignas( CacheLineSize ) std::atomic< std::size_t > m_dequeuePosition{ 0 };
+
+		// position부터 최대 maxCount개의, sequence가 position + offset인 연속된 slot을 얻습니다.
+		// 생산자는 offset 0( 비어있는 slot ), 소비자는 offset 1( 채워진 slot )을 사용합니다.
+		[[nodiscard]] Claim _Claim( std::atomic< std::size_t >& position, const std::size_t offset, std::size_t maxCount ) noexcept
+		{
+			// 얻을 slot이 없다면, 아래의 루프는 count == 0을 다른 스레드와의 경합으로 보고 끝나지 않습니다.
+			if ( maxCount == 0 )
+				return { position.load( std::memory_order_relaxed ), 0 };
+
+			maxCount = std::min( maxCount, m_mask + 1 );
+
+			std::size_t current = position.load( std::memory_order_relaxed );
+			for ( ;; )
+			{
+				std::size_t count = 0;
+				while ( count < maxCount && m_cells[ ( current + count ) & m_mask ].sequence.load( std::memory_order_acquire ) == current + count + offset )
+					++count;
+
+				if ( count == 0 )
+				{
+					const std::size_t sequence = m_cells[ current & m_mask ].sequence.load( std::memory_order_acquire );
+					const auto        diff     = static_cast< std::ptrdiff_t >( sequence - ( current + offset ) );
+
+					// 아직 이번 바퀴가 되지 않은 slot이라면, 가득 차있거나( 생산자 ) 비어있습니다( 소비자 ).
+					if ( diff < 0 )
+						return { current, 0 };
+
+					// 다른 스레드가 먼저 가져갔다면, 위치를 다시 읽습니다.
+					if ( diff > 0 )
+						current = position.load( std::memory_order_relaxed );
+
+					continue;
+				}
+
+				if ( position.compare_exchange_weak( current, current + count, std::memory_order_relaxed, std::memory_order_relaxed ) )
+					return { current, count };
+			}
+		}
+
+		void _Fill( const std::size_t position, Type&& data ) noexcept
+		{
+			Cell& cell = m_cells[ position & m_mask ];
+			cell.data  = std::move( data );
+			cell.sequence.store( position + 1, std::memory_order_release );
+		}
+
+		[[nodiscard]] Type _Take( const std::size_t position ) noexcept
+		{
+			Cell& cell = m_cells[ position & m_mask ];
+			Type  data = std::exchange( cell.data, Type( nullptr ) );
+			cell.sequence.store( position + m_mask + 1, std::memory_order_release );
+
+			return data;
+		}
+
+	public:
+		explicit NotNullQueue( const std::size_t capacity )
+			: m_mask { std::bit_ceil( std::max< std::size_t >( capacity, 2 ) ) - 1 }
+			, m_cells( std::make_unique< Cell[] >( m_mask + 1 )                     )
+		{
+			for ( std::size_t index = 0; index <= m_mask; ++index )
+				m_cells[ index ].sequence.store( index, std::memory_order_relaxed );
+		}
+
+		NotNullQueue( const NotNullQueue& )            = delete;
+		NotNullQueue& operator=( const NotNullQueue& ) = delete;
+
+		[[nodiscard]] std::size_t GetCapacity() const noexcept
+		{
+			return m_mask + 1;
+		}
+
+		// 다른 스레드에서 넣고 꺼내는 중이라면, 근사값입니다.
+		[[nodiscard]] std::size_t GetApproxSize() const noexcept
+		{
+			const std::size_t dequeuePosition = m_dequeuePosition.load( std::memory_order_relaxed );
+			const std::size_t enqueuePosition = m_enqueuePosition.load( std::memory_order_relaxed );
+
+			return enqueuePosition > dequeuePosition ? std::min( enqueuePosition - dequeuePosition, GetCapacity() ) : 0;
+		}
+
+		// 가득 찬 경우 false를 반환하며, notNull은 옮겨지지 않습니다.
+		[[nodiscard]] bool TryPush( NotNullType&& notNull ) noexcept
+		{
+			const Claim claim = _Claim( m_enqueuePosition, 0, 1 );
+			if ( claim.count == 0 )
+				return false;
+
+			_Fill( claim.position, std::move( notNull ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() );
+			return true;
+		}
+
+		// 비어있는 경우 null을 반환합니다.
+		[[nodiscard]] NullableType TryPop() noexcept
+		{
+			const Claim claim = _Claim( m_dequeuePosition, 1, 1 );
+			if ( claim.count == 0 )
+				return nullptr;
+
+			return NullableType( _Take( claim.position ) );
+		}
+
+		// [ first, last )의 NotNull들을 앞에서부터 넣을 수 있는 만큼 옮겨 넣고, 넣은 수를 반환합니다.
+		template< std::forward_iterator Iter >
+			requires std::same_as< std::iter_value_t< Iter >, NotNullType >
+		[[nodiscard]] std::size_t TryPushBatch( Iter first, const Iter last ) noexcept
+		{
+			const Claim claim = _Claim( m_enqueuePosition, 0, static_cast< std::size_t >( std::distance( first, last ) ) );
+
+			for ( std::size_t index = 0; index < claim.count; ++index, ++first )
+				_Fill( claim.position + index, std::move( *first ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() );
+
+			return claim.count;
+		}
+
+		// 최대 maxCount개의 NotNull을 꺼내 out에 넣고, 꺼낸 수를 반환합니다.
+		// slot을 얻은 이후에는 되돌릴 수 없으므로, out은 예외가 발생하지 않아야 합니다.
+		template< NothrowOutputIterator< NotNullType > Out >
+		std::size_t TryPopBatch( Out out, const std::size_t maxCount ) noexcept
+		{
+			const Claim claim = _Claim( m_dequeuePosition, 1, maxCount );
+
+			for ( std::size_t index = 0; index < claim.count; ++index )
+			{
+				*out = NotNullType::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( _Take( claim.position + index ) );
+				++out;
+			}
+
+			return claim.count;
+		}
+
+		// 최대 maxCount개의 NotNull을 꺼내 container의 뒤에 넣고, 꺼낸 수를 반환합니다.
+		// slot을 얻기 전에 reserve하므로, 할당이 실패하면 아무것도 꺼내지 않고 예외가 발생합니다.
+		template< ReservableContainer< NotNullType > Container >
+		std::size_t TryPopBatch( Container& container, std::size_t maxCount )
+		{
+			maxCount = std::min( maxCount, m_mask + 1 );
+			container.reserve( container.size() + maxCount );
+
+			const Claim claim = _Claim( m_dequeuePosition, 1, std::min< std::size_t >( maxCount, container.capacity() - container.size() ) );
+
+			for ( std::size_t index = 0; index < claim.count; ++index )
+				container.push_back( NotNullType::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( _Take( claim.position + index ) ) );
+
+			return claim.count;
+		}
+	};
+}
+
+template< typename Type >
+using WsyNotNullQueue = WonSY::NotNullQueue< Type >;
+
+template< typename T >
+using WsyNotNullQueueUnique = WonSY::NotNullQueue< WsyUniquePtr< T > >;
+
+#endif
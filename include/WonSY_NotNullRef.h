@@ -0,0 +1,113 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_NOTNULL_REF
+#define WONSY_NOTNULL_REF
+
+#include <memory>
+#include <functional>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+
+
+namespace WonSY
+{
+	/*
+		소유권이 없는( 빌려온 ) NotNull입니다. 내부적으로는 ElementType*만 가지고 있습니다.
+
+		EXPAND_TO_NOTNULL_REF 계열 매크로로 Nullable에서 확장되거나, NotNull< Type >에서 바로 변환되며,
+		이 때 shared_ptr의 복사가 발생하지 않으므로, 레퍼런스 카운트도 변하지 않습니다.
+
+		NotNull과 동일하게 항상 유효한 데이터를 가리키지만, 소유권이 없기 때문에
+		원본 Nullable( 혹은 NotNull )의 스코프 안에서만 사용해야 합니다. ( 멤버 변수나 컨테이너에 저장하지 마세요. )
+
+		함수 인자로 사용 시, const WsyNotNull< T >& 대신 WsyNotNullRef< ElementType >를 값으로 받으면,
+		NotNull< T* >, NotNull< shared_ptr >, NotNull< unique_ptr >와 확장된 NotNullRef 모두를 복사 없이 받을 수 있습니다.
+
+		[ Version ]
+		// 0.1
+			- EXPAND_TO_NOTNULL이 shared_ptr을 복사하면서 발생하는 레퍼런스 카운트 원자 연산을 피하기 위해, 빌려온 NotNull을 추가합니다.
+	*/
+
+	template< typename _ElementType >
+	class [[nodiscard]] NotNullRef
+	{
+	public:
+		using ElementType = _ElementType;
+
+	private:
+		ElementType* m_element;
+
+	public:
+#pragma region [ CTOR, DTOR ]
+		// 기본 생성자는 제거합니다.
+		NotNullRef() = delete;
+
+		~NotNullRef() noexcept = default;
+
+		// 빌려온 포인터일 뿐이므로, 복사는 포인터 복사입니다.
+		NotNullRef( const NotNullRef& )            noexcept = default;
+		NotNullRef& operator=( const NotNullRef& ) noexcept = default;
+
+		// NotNull< Type >은 항상 유효하므로, 언제든지 빌려올 수 있습니다.
+		template< NotNullRequire Type >
+			requires std::is_same_v< typename NotNull< Type >::ElementType, ElementType >
+		NotNullRef( const NotNull< Type >& notnull ) noexcept
+			: m_element{ std::addressof( notnull() ) }
+		{
+		}
+
+		// 임시 NotNull을 빌려오면 바로 댕글링되므로 제한합니다.
+		template< NotNullRequire Type >
+		NotNullRef( const NotNull< Type >&& ) = delete;
+
+	private:
+		// 생성자를 private하게 처리하고 FactoryFunc( DoNotCall_____MY_NAME_IS_NOT_NULL_REF__NICE_TO_MEET_YOU )로만 제공한다.
+		explicit NotNullRef( ElementType& element ) noexcept
+			: m_element{ std::addressof( element ) }
+		{
+		}
+	public:
+#pragma endregion
+
+#pragma region [ FactoryFunc Or Othres ]
+		// 매크로( Nullable의 확장 )에 의해서만 실행되어야 하는 함수입니다.
+		[[nodiscard]] static NotNullRef DoNotCall_____MY_NAME_IS_NOT_NULL_REF__NICE_TO_MEET_YOU( ElementType& element ) noexcept
+		{
+			return NotNullRef( element );
+		}
+	public:
+#pragma endregion
+
+#pragma region [ Operator ]
+		operator ElementType&() const noexcept
+		{
+			return *m_element;
+		}
+
+		// 위 Opertator이 의도와 다르게, 동작되지 않을 때 사용합니다.
+		ElementType& operator()() const noexcept
+		{
+			return *m_element;
+		}
+
+		// NotNull과 동일하게, 가리키는 데이터에 값을 할당합니다. ( 다른 데이터를 가리키도록 바꾸는 것이 아닙니다. )
+		void operator=( const ElementType& ele )
+		{
+			*m_element = ele;
+		}
+#pragma endregion
+	};
+}
+
+template< typename T >
+using WsyNotNullRef = WonSY::NotNullRef< T >;
+
+#endif
@@ -0,0 +1,369 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_NOTNULL_TASK
+#define WONSY_NOTNULL_TASK
+
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull< Type >으로 완료되는 C++20 코루틴 NotNullTask와, 코루틴을 실행하는 ThreadPoolExecutor입니다.
+
+		디스크 로드 등 오래 걸리는 생성을 동기적으로 처리하면, 호출한 스레드가 그 동안 멈추게 됩니다.
+		NotNullTask를 반환하는 코루틴은 co_await으로 다른 NotNullTask나 awaitable( AsyncNotNullCache::Acquire 등 )을 기다리며, 기다리는 동안 스레드를 점유하지 않습니다.
+
+			- NotNullTask는 co_await될 때 시작되며( lazy ), co_return한 NotNull을 co_await의 결과로 반환합니다.
+			- 코루틴에서 발생한 예외는 co_await한 곳으로 전달됩니다.
+			- 완료되면 기다리던 코루틴을 같은 스레드에서 바로 재개합니다. ( symmetric transfer, 스택이 쌓이지 않습니다. )
+			- SyncWait( task )는 코루틴이 아닌 곳( main 등 )에서 task가 완료될 때까지 기다린 후 결과를 반환합니다.
+			- ThreadPoolExecutor는 고정된 수의 스레드로 Post된 작업을 처리하며, co_await executor.Schedule()로 코루틴을 풀의 스레드로 옮깁니다.
+
+		주의 해야할 것은,
+			- NotNullTask는 한 번만 co_await할 수 있으며, 결과는 옮겨집니다.
+			- 코루틴의 인자로 레퍼런스를 받으면, co_await 이후에는 댕글링될 수 있습니다. ( 값으로 받아주세요. )
+			- SyncWait를 ThreadPoolExecutor의 스레드에서 호출하면, 풀의 스레드가 모두 멈출 수 있습니다.
+			- ThreadPoolExecutor는 소멸 시 남아있는 작업을 모두 처리한 후 종료합니다.
+
+		[ Version ]
+		// 0.1
+			- 오래 걸리는 NotNull의 생성을 비동기로 기다리기 위해, NotNullTask, SyncWait, ThreadPoolExecutor를 추가하였습니다.
+	*/
+
+	template< NotNullRequire _Type >
+	class NotNullTask
+	{
+	public:
+		using Type        = _Type;
+		using ElementType = WsyElementType< _Type >::Type;
+		using NotNullType = NotNull< Type >;
+
+		class promise_type
+		{
+			friend class NotNullTask;
+
+		private:
+			std::optional< NotNullType > m_notNull;
+			std::exception_ptr           m_exception;
+			std::coroutine_handle<>      m_continuation = std::noop_coroutine();
+
+			// 완료되면, 기다리던 코루틴으로 바로 넘어갑니다.
+			class FinalAwaiter
+			{
+			public:
+				bool await_ready() const noexcept
+				{
+					return false;
+				}
+
+				std::coroutine_handle<> await_suspend( const std::coroutine_handle< promise_type > handle ) noexcept
+				{
+					return handle.promise().m_continuation;
+				}
+
+				void await_resume() const noexcept
+				{
+				}
+			};
+
+		public:
+			NotNullTask get_return_object() noexcept
+			{
+				return NotNullTask( std::coroutine_handle< promise_type >::from_promise( *this ) );
+			}
+
+			std::suspend_always initial_suspend() const noexcept
+			{
+				return {};
+			}
+
+			FinalAwaiter final_suspend() const noexcept
+			{
+				return {};
+			}
+
+			template< typename U >
+				requires std::is_convertible_v< U&&, NotNullType >
+			void return_value( U&& notNull ) noexcept( std::is_nothrow_convertible_v< U&&, NotNullType > )
+			{
+				m_notNull.emplace( std::forward< U >( notNull ) );
+			}
+
+			void unhandled_exception() noexcept
+			{
+				m_exception = std::current_exception();
+			}
+		};
+
+	private:
+		std::coroutine_handle< promise_type > m_handle;
+
+		explicit NotNullTask( const std::coroutine_handle< promise_type > handle ) noexcept
+			: m_handle{ handle }
+		{
+		}
+
+	public:
+		NotNullTask( NotNullTask&& other ) noexcept
+			: m_handle{ std::exchange( other.m_handle, nullptr ) }
+		{
+		}
+
+		NotNullTask& operator=( NotNullTask&& other ) noexcept
+		{
+			if ( this != &other )
+			{
+				if ( m_handle )
+					m_handle.destroy();
+
+				m_handle = std::exchange( other.m_handle, nullptr );
+			}
+
+			return *this;
+		}
+
+		NotNullTask( const NotNullTask& )            = delete;
+		NotNullTask& operator=( const NotNullTask& ) = delete;
+
+		~NotNullTask()
+		{
+			if ( m_handle )
+				m_handle.destroy();
+		}
+
+		bool await_ready() const noexcept
+		{
+			return m_handle.done();
+		}
+
+		// 기다리는 코루틴을 기록한 후, 이 task를 시작합니다.
+		std::coroutine_handle<> await_suspend( const std::coroutine_handle<> continuation ) noexcept
+		{
+			m_handle.promise().m_continuation = continuation;
+			return m_handle;
+		}
+
+		NotNullType await_resume()
+		{
+			promise_type& promise = m_handle.promise();
+			if ( promise.m_exception )
+				std::rethrow_exception( promise.m_exception );
+
+			return std::move( *promise.m_notNull );
+		}
+	};
+
+	namespace Detail
+	{
+		// SyncWait에서만 사용하는, 바로 시작되고 완료되면 스스로 해제되는 코루틴입니다.
+		class DetachedTask
+		{
+		public:
+			class promise_type
+			{
+			public:
+				DetachedTask get_return_object() const noexcept
+				{
+					return {};
+				}
+
+				std::suspend_never initial_suspend() const noexcept
+				{
+					return {};
+				}
+
+				std::suspend_never final_suspend() const noexcept
+				{
+					return {};
+				}
+
+				void return_void() const noexcept
+				{
+				}
+
+				void unhandled_exception() const noexcept
+				{
+					std::terminate();
+				}
+			};
+		};
+
+		template< typename NotNullType >
+		class SyncWaitState
+		{
+		public:
+			std::mutex                   mutex;
+			std::condition_variable      condition;
+			bool                         isDone = false;
+			std::optional< NotNullType > notNull;
+			std::exception_ptr           exception;
+		};
+
+		template< typename Type >
+		DetachedTask RunSyncWait( NotNullTask< Type > task, SyncWaitState< NotNull< Type > >& state )
+		{
+			try
+			{
+				state.notNull.emplace( co_await task );
+			}
+			catch ( ... )
+			{
+				state.exception = std::current_exception();
+			}
+
+			// 기다리는 스레드가 state를 해제할 수 있으므로, lock을 잡은 채로 알립니다.
+			std::lock_guard lock( state.mutex );
+			state.isDone = true;
+			state.condition.notify_one();
+		}
+	}
+
+	// task가 완료될 때까지 호출한 스레드에서 기다린 후, 결과를 반환합니다. ( 예외는 다시 던져집니다. )
+	template< typename Type >
+	[[nodiscard]] NotNull< Type > SyncWait( NotNullTask< Type > task )
+	{
+		Detail::SyncWaitState< NotNull< Type > > state;
+		Detail::RunSyncWait( std::move( task ), state );
+
+		std::unique_lock lock( state.mutex );
+		state.condition.wait( lock, [ &state ]() { return state.isDone; } );
+
+		if ( state.exception )
+			std::rethrow_exception( state.exception );
+
+		return std::move( *state.notNull );
+	}
+
+	class ThreadPoolExecutor
+	{
+	public:
+		using JobType = std::function< void() >;
+
+	private:
+		std::mutex                  m_mutex;
+		std::condition_variable_any m_condition;
+		std::deque< JobType >       m_jobs;
+		std::vector< std::jthread > m_threads;
+
+		void _Run( const std::stop_token stopToken )
+		{
+			for ( ;; )
+			{
+				JobType job;
+				{
+					std::unique_lock lock( m_mutex );
+
+					// 종료를 요청받더라도, 남아있는 작업을 모두 처리합니다.
+					m_condition.wait( lock, stopToken, [ this ]() { return !m_jobs.empty(); } );
+					if ( m_jobs.empty() )
+						return;
+
+					job = std::move( m_jobs.front() );
+					m_jobs.pop_front();
+				}
+
+				job();
+			}
+		}
+
+		// Schedule()의 결과로, co_await하면 풀의 스레드에서 재개됩니다.
+		class ScheduleAwaiter
+		{
+		private:
+			ThreadPoolExecutor* m_executor;
+
+		public:
+			explicit ScheduleAwaiter( ThreadPoolExecutor& executor ) noexcept
+				: m_executor{ &executor }
+			{
+			}
+
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			void await_suspend( const std::coroutine_handle<> handle )
+			{
+				m_executor->Post( [ handle ]() { handle.resume(); } );
+			}
+
+			void await_resume() const noexcept
+			{
+			}
+		};
+
+	public:
+		explicit ThreadPoolExecutor( const std::size_t threadCount = std::max< std::size_t >( std::thread::hardware_concurrency(), 1 ) )
+		{
+			m_threads.reserve( threadCount );
+			for ( std::size_t index = 0; index < threadCount; ++index )
+				m_threads.emplace_back( [ this ]( const std::stop_token stopToken ) { _Run( stopToken ); } );
+		}
+
+		ThreadPoolExecutor( const ThreadPoolExecutor& )            = delete;
+		ThreadPoolExecutor& operator=( const ThreadPoolExecutor& ) = delete;
+
+		// 남아있는 작업을 처리한 후, 스레드들을 종료합니다.
+		~ThreadPoolExecutor()
+		{
+			for ( std::jthread& thread : m_threads )
+				thread.request_stop();
+
+			m_threads.clear();
+		}
+
+		void Post( JobType job )
+		{
+			{
+				std::lock_guard lock( m_mutex );
+				m_jobs.push_back( std::move( job ) );
+			}
+
+			m_condition.notify_one();
+		}
+
+		[[nodiscard]] ScheduleAwaiter Schedule() noexcept
+		{
+			return ScheduleAwaiter( *this );
+		}
+
+		[[nodiscard]] std::size_t GetThreadCount() const noexcept
+		{
+			return m_threads.size();
+		}
+	};
+}
+
+template< typename T >
+using WsyNotNullTask = WonSY::NotNullTask< T >;
+
+template< typename T >
+using WsyNotNullTaskShared = WonSY::NotNullTask< WsySharedPtr< T > >;
+
+#endif
@@ -0,0 +1,81 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_NOTNULL_VIEWS
+#define WONSY_NOTNULL_VIEWS
+
+#include <ranges>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_NotNullRef.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		Nullable의 range에서 null을 건너뛰고, 빌려온 NotNullRef< ElementType >로 확장하는 range adaptor( views::expand_not_null )입니다.
+
+		Nullable의 컨테이너를 순회하려면 루프마다 EXPAND_TO_NOTNULL_CONTINUE를 작성하거나, 유효한 요소들을 NotNull의 임시 vector로 복사해야 합니다.
+		views::expand_not_null은 순회할 때마다 요소를 확인하여 바로 빌려오므로, 임시 저장소와 shared_ptr의 복사( 레퍼런스 카운트 원자 연산 )가 없습니다.
+
+			- nullables | WonSY::views::expand_not_null 로 사용하며, std::views::filter, std::views::transform 등과 이어서 사용할 수 있습니다.
+			- std::views::filter와 std::views::transform을 합친 range adaptor closure이므로, 표준 view와 같이 지연( lazy ) 평가됩니다.
+			- 요소는 EXPAND_TO_NOTNULL_REF와 같은 NotNullRef< ElementType >입니다.
+
+		주의 해야할 것은,
+			- NotNullRef는 빌려온 것이므로, 원본 range의 요소가 유지되는 동안에만 사용해야 합니다.
+			- 순회하는 동안 다른 곳( 혹은 다른 스레드 )에서 요소를 Release하거나 null을 할당하면 안됩니다.
+			- 임시 Nullable을 반환하는 range( Nullable을 반환하는 transform 등 )는 빌려올 수 없으므로, 컴파일되지 않습니다.
+			- weak_ptr은 lock() 없이 빌려올 수 없으므로 지원하지 않습니다.
+			- std::views::filter와 같이, begin()은 처음 호출 시 첫 유효한 요소를 찾아 기록합니다. ( 순회 중 원본을 수정하지 마세요. )
+
+		[ Version ]
+		// 0.1
+			- EXPAND_TO_NOTNULL_CONTINUE 루프와 NotNull의 임시 vector를 대체하기 위해, views::expand_not_null을 추가하였습니다.
+	*/
+
+	namespace Detail
+	{
+		class IsExpandableFunc
+		{
+		public:
+			template< NullableRequire Type >
+				requires PointerTraitsType< Type >
+			constexpr bool operator()( const Nullable< Type >& nullable ) const noexcept
+			{
+				return static_cast< bool >( nullable );
+			}
+		};
+
+		// IsExpandableFunc로 확인된 요소만 전달됩니다.
+		class LendNotNullFunc
+		{
+		public:
+			template< NullableRequire Type >
+				requires PointerTraitsType< Type >
+			constexpr NotNullRef< typename Nullable< Type >::ElementType > operator()( const Nullable< Type >& nullable ) const noexcept
+			{
+				return nullable.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__LEND_ME_YOUR_NAME();
+			}
+
+			// 임시 Nullable을 빌려오면 바로 댕글링되므로 제한합니다.
+			template< NullableRequire Type >
+			void operator()( const Nullable< Type >&& ) const = delete;
+		};
+	}
+
+	namespace views
+	{
+		inline constexpr auto expand_not_null = std::views::filter( Detail::IsExpandableFunc{} ) | std::views::transform( Detail::LendNotNullFunc{} );
+	}
+}
+
+#endif
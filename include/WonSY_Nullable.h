@@ -18,151 +18,404 @@
 
 #endif
 
+#include <compare>
+#include <cstdint>
 #include <memory>
 #include <functional>
+#include <utility>
 
 #include "WonSY_TypeUtil.h"
 #include "WonSY_NotNull.h"
+#include "WonSY_NotNullRef.h"
 
 namespace WonSY
 {
 	/*
-		"Null  ְ ƴҼ ִ"   Ptr  ǥ, 
-		"  ü  ʴ Ÿ̱ ", Null ߻Ű ʽϴ.
+		"Null일 수도 있고 아닐수도 있는" 기존과 동일한 Ptr의 개념을 표현하지만, 
+		"데이터의 접근 자체를 허용하지 않는 타입이기 때문에", Null참조를 발생시키지 않습니다.
 
-		"Ϳ ϱ ؼ NotNull ȯ( EXPAND_TO_NOTNULL ) ,    մϴ.
+		"데이터에 접근하기 위해서는 NotNull로의 변환( EXPAND_TO_NOTNULL ) 이후, 성공 시 접근이 가능합니다.
 
 		[ Version ]
 		// 0.1 
-			-  C++ ǥ Ϳ  ģδ Null õ ̽ ϱ ƴٰ ǴϿ, 
-			  ̸ غϱ  ο ģ NotNull ̿ CouplingǴ  Nullable Designմϴ.
+			- 기존의 C++ 표준의 포인터와 그 친구들로는 Null과 관련된 이슈에서 안전하기 어렵다고 판단하여, 
+			  이를 극복하기 위한 새로운 친구 NotNull과 이와 Coupling되는 개념 Nullable를 Design합니다.
 
 		// 0.2 
-			- NullableRequire Concept  ( IsRawPtr< T >::value || IsSharedPtr< T >::value || IsUniquePtr< T >::value )
+			- NullableRequire Concept 개념 적용( IsRawPtr< T >::value || IsSharedPtr< T >::value || IsUniquePtr< T >::value )
 
 		// 0.3 
-			- Nullable< UniquePtr< T > > NotNull ȯ , NotNull< UniquePtr > NotNull< SharedPtr > ȯǵ -մϴ.
+			- Nullable< UniquePtr< T > >의 NotNull로의 변환 시, NotNull< UniquePtr >에서 NotNull< SharedPtr >로 변환되도록 적용-개선합니다.
 			
 		// 0.4 
-			- ȯ  SharedPtr óǸ鼭( 0.3ver )  Nullable ۸óǴ ̽ ־, NotNull Unique_ptr ϰ, Nullable unique_ptr ϴ  Ѵ.
-			 ũ ̸ , , ؼ ᱹ EXPAND_TO_NOTNULL մϴ. (    ʾ;  ߰   ;; )
+			- 변환 시 SharedPtr로 처리되면서( 0.3ver ) 원래 Nullable가 댕글링처리되는 이슈가 있어, NotNull은 Unique_ptr를 허용하고, Nullable은 unique_ptr을 재한하는 방향으로 진행한다.
+			 매크로 이름 수정, 수정, 수정해서 결국 EXPAND_TO_NOTNULL로 적용합니다. ( 완전 마음에 들지는 않아; 추후 추가 수정이 될 수도;; )
 
 		// 0.5
-			- ʿغ̴ ڵ ,  غδ.
-			- ޸  Լ , Clear, Release ó Ͽϴ. ( T STL Container , container ClearԼ   ־, ǥذ ߺʴ ̸ մϴ. 
-			- EXPAND_TO_NOTNULL Ͽ, ݺ  ũ ߰Ͽϴ.
+			- 불필요해보이는 생성자들 제거, 쓸데없이 복잡해보인다.
+			- 메모리 해제 함수 명을, Clear에서, Release로 변경처리 하였습니다. ( T가 STL Container일 경우, container의 Clear함수와 착오할 수 있어, 표준과 중복되지않는 이름으로 변경합니다. 
+			- EXPAND_TO_NOTNULL과 관련하여, 반복문에서 쓰일 매크로 추가하였습니다.
 
 		// 0.6
-			- ElementType ڷ ޵Ǿ , enable_shared_from_this()  ο , shared_from_this() óϴ  ߸Ȱ ȮεǾ մϴ.
-			- Ī WsyNullableRaw, WsyNullableShared ߰Ͽϴ.
+			- ElementType가 인자로 전달되었을 때, enable_shared_from_this()의 상속 여부에 따라, shared_from_this() 처리하던 로직은 잘못된것임이 확인되어 제거합니다.
+			- 별칭 WsyNullableRaw, WsyNullableShared 추가하였습니다.
+
+		// 0.7
+			- EXPAND_TO_NOTNULL은 shared_ptr을 복사하기 때문에, 확장 시마다 레퍼런스 카운트의 원자 연산이 발생합니다.
+			  이를 피하기 위해, 빌려온 NotNullRef로 확장하는 EXPAND_TO_NOTNULL_REF 계열 매크로를 추가하였습니다.
+			- 생성자 인자를 그대로 전달하여 제자리 생성하는 EmplaceNullable을 추가하였습니다. ( MakeNullable도 같은 생성자를 사용합니다. )
+
+		// 0.8
+			- Type, Nullable, NotNull의 rvalue를 받는 생성자와 할당 연산자를 추가하여, 스마트포인터가 복사되지 않고 이동되도록 합니다.
+			- nullable을 소모하여 NotNull로 옮기는 EXPAND_TO_NOTNULL_MOVE 계열 매크로를 추가하였습니다. ( 확장 이후 nullable은 null이 됩니다. )
+
+		// 0.9
+			- Allocator, memory_resource에서 할당하는 AllocateNullable과, 같은 Allocator로 메모리를 돌려주는 Release( alloc )를 추가하였습니다.
+
+		// 0.10
+			- 작은 ElementType을 힙 할당 없이 직접 담는 Inline< T >를 지원합니다. ( NullableRequire에 IsInline< T > 추가 )
+			  값 타입이므로, EXPAND_TO_NOTNULL은 값을 복사하며 원본의 수정이 필요할 경우 EXPAND_TO_NOTNULL_REF를 사용합니다.
+
+		// 0.11
+			- 레퍼런스 카운트를 개체 내부에 두어, 포인터 크기의 핸들을 가지는 IntrusivePtr< T >를 지원합니다. ( NullableRequire에 IsIntrusivePtr< T > 추가 )
+
+		// 0.12
+			- 한 스레드 안에서 원자 연산 없이 공유되는 LocalSharedPtr< T >를 지원합니다. ( NullableRequire에 IsLocalSharedPtr< T > 추가 )
+
+		// 0.13
+			- NullableRequire를 고정된 타입 목록 대신, 사용자 타입이 특수화할 수 있는 PointerTraits< T >로 판단합니다. ( unique_ptr은 여전히 제한합니다. )
+			  null 확인과 역참조는 PointerTraits를 통하며, 사용자 타입의 생성( Make )과 해제( Release )도 PointerTraits에 정의된 경우 사용합니다.
+
+		// 0.14
+			- 포인터의 하위 비트에 소유권과 사용자 Tag를 담는 TaggedPtr< T >를 지원하며, Tag에 접근하는 IsOwner, HasTag, SetTag를 추가하였습니다.
+			  Nullable< TaggedPtr< T > >의 Release()는 Owner일 때만 delete하므로, 빌려온 포인터에서 호출해도 안전합니다.
+
+		// 0.15
+			- Nullable< weak_ptr< T > >를 지원합니다. null 확인은 lock() 없이 expired()로 처리하며, 
+			  EXPAND_TO_NOTNULL 계열 매크로는 한번만 lock()하여 NotNull< shared_ptr< T > >( _REF는 lock()한 shared_ptr을 빌려온 NotNullRef )로 확장합니다.
+			- 매크로는 확장 대상( ARE_YOU_THERE )을 먼저 얻은 후 null을 확인합니다. weak_ptr 이외의 Type은 nullable 자신의 참조이므로 추가 비용이 없습니다.
+
+		// 0.16
+			- 0.4에서 제한하였던 Nullable< unique_ptr< T > >를 다시 지원합니다. ( 독점 소유권을 위해 shared_ptr을 사용하지 않아도 됩니다. )
+			  EXPAND_TO_NOTNULL은 소유권을 옮기지 않고 빌려온 NotNull< ElementType* >로 확장하며, ( 0.4의 댕글링 이슈가 발생하지 않습니다. )
+			  EXPAND_TO_NOTNULL_MOVE는 소유권을 NotNull< unique_ptr< T > >로 옮기고, Release()는 소유한 ElementType을 해제합니다.
+
+		// 0.17
+			- Type이 변환을 허용하는 다른 Type의 Nullable, NotNull에서의 암시적 변환( Derived에서 Base로의 업캐스트, unique_ptr에서 shared_ptr 등 )을 추가하였습니다.
+			  명시적인 캐스트는 WonSY_PointerCast.h의 StaticCast, DynamicCast, ConstCast를 사용합니다.
+
+		// 0.18
+			- 가리키는 개체( Identity, 기본적으로 주소 )로 비교하는 operator==, operator<=>와 std::hash를 추가하였습니다. ( null은 가장 앞에 정렬됩니다. )
+			  operator bool로 변환되어 bool끼리 비교되던 nullable == nullable은, 이제 같은 개체를 가리키는지 비교합니다. ( weak_ptr은 지원하지 않습니다. )
+
+		// 0.19
+			- PointerTraits< T >::Pin()이 정의된 Type은, 매크로가 Pin()의 Guard를 먼저 얻은 후 복사한 PinnedNullable로 확장합니다.
+			  Guard는 확장한 스코프 동안 유지되므로, EpochPtr< T >처럼 Release()가 지연된 해제를 하는 경우 확장한 NotNull이 댕글링되지 않습니다.
+
+		// 0.20
+			- 함수 반환 값 등 임시 nullable을 확장하면, 확장 대상이 매크로의 변수 선언 직후 소멸되던 문제를 수정하였습니다. ( 값으로 옮겨 유지합니다. )
 	*/
 
 	template < typename T >
-	concept NullableRequire = IsRawPtr< T >::value || IsSharedPtr< T >::value; // ũ Ptr  ģ ƹ ص, Nullable ϸ , Notnull ǵ Ѵ || IsUniquePtr< T >::value;
+	concept NullableRequire = PointerTraitsType< T > || IsWeakPtr< T >::value; // [ ver 0.16 ] unique_ptr은 빌려온 NotNull< ElementType* >로 확장하여 다시 허용합니다.
+
+	// Nullable< T >와 서로 변환되는 NotNull 타입입니다. ( weak_ptr은 lock()한 shared_ptr의 NotNull과 변환됩니다. )
+	template < typename T >
+	class NotNullTypeOf
+	{
+	public:
+		using Type = NotNull< T >;
+	};
+
+	template < typename T >
+	class NotNullTypeOf< std::weak_ptr< T > >
+	{
+	public:
+		using Type = NotNull< std::shared_ptr< T > >;
+	};
+
+	template< NullableRequire _Type >
+	class PinnedNullable;
 
 	template< NullableRequire _Type >
 	class Nullable
 	{
+		// WonSY_PointerCast.h, 캐스트에 실패한 경우 원본을 유지하기 위해 m_data에 직접 접근합니다.
+		friend class PointerCast;
+
 	public:
 		using Type        = _Type;
 		using ElementType = WsyElementType< _Type >::Type;
+		using NotNullType = NotNullTypeOf< _Type >::Type;
+
+		// EXPAND_TO_NOTNULL로 확장되는 NotNull 타입입니다. ( unique_ptr은 소유권을 옮기지 않도록, 빌려온 NotNull< ElementType* >로 확장됩니다. )
+		using ExpandedNotNullType = std::conditional_t< IsUniquePtr< _Type >::value, NotNull< ElementType* >, NotNullType >;
 
 	private:
 		Type m_data;
 
+		// null인 Type을 반환합니다. ( weak_ptr은 nullptr로 생성할 수 없습니다. )
+		static Type _MakeNull() noexcept
+		{
+			if constexpr ( IsWeakPtr< Type >::value )
+				return Type();
+			else
+				return Type( nullptr );
+		}
+
 	public:
 #pragma region [ CTOR, DTOR, Operator ]
-		// ⺻ ڴ nullptr óش.
+		// 기본 생성자는 nullptr로 처리해준다.
 		Nullable() noexcept
-			: m_data{ nullptr }
+			: m_data{ _MakeNull() }
 		{
 		}
 
-		//  data*  Ѵ. ( todo : , Ʈ͸ ̵ Ѵ. )
-		Nullable( const Type data ) noexcept
-			: m_data{ data }
+		// 기존 data*를 얕게 복사한다. 값으로 받아 옮기므로, 스마트포인터의 임시 객체( rvalue )는 레퍼런스 카운트 변화 없이 이동된다.
+		Nullable( Type data ) noexcept
+			: m_data{ std::move( data ) }
 		{
 		}
 
-		//  nullable  ڷ   ֵ óش.
+		// 같은 nullable을 생성자 인자로 받을 수 있도록 처리해준다.
 		Nullable( const Nullable< Type >& rhs ) = default;
 
-		// NotNull Nullable ȯ  ؾѴ.
-		Nullable( const NotNull< Type >& rhs )
+		// 이동된 nullable은 null이 됩니다. ( RawPtr일 경우에도 null로 만들어, 같은 메모리를 두 번 Release하지 않도록 합니다. )
+		Nullable( Nullable< Type >&& rhs ) noexcept
+			: m_data{ std::exchange( rhs.m_data, _MakeNull() ) }
+		{
+		}
+
+		// NotNull에서 Nullable 전환은 언제든지 가능해야한다.
+		Nullable( const NotNullType& rhs )
 			: m_data( rhs.DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
 		{
 		}
 
-		// nullptr ڷ ޴ ڸ ߰ش.
+		// 소멸될 NotNull( rvalue )에서의 전환은, 복사하지 않고 옮겨온다.
+		Nullable( NotNullType&& rhs ) noexcept
+			: m_data( std::move( rhs ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
+		{
+		}
+
+		// weak_ptr 일 경우, 관찰할 shared_ptr을 인자로 받는 생성자를 추가해준다.
+		Nullable( const std::shared_ptr< ElementType >& rhs ) noexcept
+			requires IsWeakPtr< Type >::value
+			: m_data( rhs )
+		{
+		}
+
+		// Type으로 변환될 수 있는 다른 Type의 Nullable, NotNull에서의 변환( 업캐스트 등 )을 허용합니다.
+		// rvalue에서의 변환은 레퍼런스 카운트 변화 없이 옮겨오며, 이동된 nullable은 null이 됩니다.
+		// unique_ptr에서 shared_ptr로의 변환 등 할당이 필요한 변환은, Type의 변환과 같이 예외가 발생할 수 있습니다.
+		template< NullableRequire OtherType >
+			requires ( !std::is_same_v< OtherType, Type > && std::is_convertible_v< const OtherType&, Type > )
+		Nullable( const Nullable< OtherType >& rhs )
+			: m_data( rhs.DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
+		{
+		}
+
+		template< NullableRequire OtherType >
+			requires ( !std::is_same_v< OtherType, Type > && std::is_convertible_v< OtherType&&, Type > )
+		Nullable( Nullable< OtherType >&& rhs ) noexcept( std::is_nothrow_constructible_v< Type, OtherType&& > )
+			: m_data( std::move( rhs ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
+		{
+		}
+
+		template< NotNullRequire OtherType >
+			requires ( !std::is_same_v< NotNull< OtherType >, NotNullType > && std::is_convertible_v< const OtherType&, Type > )
+		Nullable( const NotNull< OtherType >& rhs )
+			: m_data( rhs.DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
+		{
+		}
+
+		template< NotNullRequire OtherType >
+			requires ( !std::is_same_v< NotNull< OtherType >, NotNullType > && std::is_convertible_v< OtherType&&, Type > )
+		Nullable( NotNull< OtherType >&& rhs ) noexcept( std::is_nothrow_constructible_v< Type, OtherType&& > )
+			: m_data( std::move( rhs ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() )
+		{
+		}
+
+		// nullptr을 인자로 받는 생성자를 추가해준다.
 		Nullable( std::nullptr_t ) noexcept
-			: m_data{ nullptr }
+			: m_data{ _MakeNull() }
 		{
 		}
 
-		//  nullable ڷ   ֵ óش. ( operator )
+		// 같은 nullable을 인자로 받을 수 있도록 처리해준다. ( operator )
 		Nullable& operator=( const Nullable< Type >& rhs ) = default;
 
-		// NotNull Nullable ȯ  ϵ óش. ( operator )
-		Nullable& operator=( const NotNull< Type >& rhs )
+		Nullable& operator=( Nullable< Type >&& rhs ) noexcept
+		{
+			if ( this != &rhs )
+				m_data = std::exchange( rhs.m_data, _MakeNull() );
+
+			return *this;
+		}
+
+		// NotNull에서 Nullable 전환은 언제든지 가능하도록 처리해준다. ( operator )
+		Nullable& operator=( const NotNullType& rhs )
 		{
 			m_data = rhs.DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD();
 			return *this;
 		}
 
-		// Type ٷ Ҵ   ֵ óݴϴ. ( operator )
-		Nullable& operator=( const Type rhs )
+		Nullable& operator=( NotNullType&& rhs ) noexcept
+		{
+			m_data = std::move( rhs ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD();
+			return *this;
+		}
+
+		// Type에서 바로 할당이 될 수 있도록 처리해줍니다. ( operator )
+		Nullable& operator=( Type rhs ) noexcept
+		{
+			m_data = std::move( rhs );
+			return *this;
+		}
+
+		Nullable& operator=( const std::shared_ptr< ElementType >& rhs ) noexcept
+			requires IsWeakPtr< Type >::value
 		{
 			m_data = rhs;
 			return *this;
 		}
 
-		// nullptr  Ҵ  ؾѴ. ٸ Raw Onwer , ޸  ߻  ִ. ( operator )
+		// nullptr  할당은 언제나 가능해야한다. 다만 Raw의 Onwer일 경우, 메모리 릭이 발생할 수 있다. ( operator )
 		Nullable& operator=( std::nullptr_t )
 		{
-			m_data = nullptr;
+			m_data = _MakeNull();
 			return *this;
 		}
 
-		// Ҹ
+		// 소멸자
 		~Nullable() noexcept = default;
-		//  ؾ , Nullable ޸   Ʈ Ͱ ƴϹǷ, 
-		// Ҹڿ Ƿ ޸𸮿 õ ó  ʽϴ.
-		// ᱹ DataType  Ÿ Ҹ  ۴ ó Դϴ.
+		// 주의 해야할 것은, Nullable은 메모리 관리를 위한 스마트 포인터가 아니므로, 
+		// 소멸자에서 임의로 메모리와 관련된 처리를 해주지 않습니다.
+		// 결국 DataType 본연 타입의 소멸 시 동작대로 처리될 것입니다.
 
-		// üũ ݴϴ.
+		// 널체크는 허용해줍니다.
 		operator bool() const
 		{
-			return m_data != nullptr;
+			return !PointerTraits< Type >::IsNull( m_data );
+		}
+
+		friend bool operator==( const Nullable& lhs, std::nullptr_t ) noexcept
+		{
+			return !lhs;
+		}
+
+		// ElementType의 값이 아닌, 가리키는 개체( Identity )가 같은지 비교합니다. ( null끼리는 같습니다. )
+		friend bool operator==( const Nullable& lhs, const Nullable& rhs ) noexcept
+			requires PointerTraitsType< Type >
+		{
+			return lhs.GetIdentity() == rhs.GetIdentity();
+		}
+
+		friend bool operator==( const Nullable& lhs, const NotNullType& rhs ) noexcept
+			requires PointerTraitsType< Type >
+		{
+			return lhs.GetIdentity() == rhs.GetIdentity();
+		}
+
+		// 가리키는 개체의 주소 순으로 정렬합니다. ( null은 가장 앞입니다. )
+		friend std::strong_ordering operator<=>( const Nullable& lhs, const Nullable& rhs ) noexcept
+			requires PointerTraitsType< Type >
+		{
+			return lhs.GetIdentity() <=> rhs.GetIdentity();
+		}
+
+		friend std::strong_ordering operator<=>( const Nullable& lhs, const NotNullType& rhs ) noexcept
+			requires PointerTraitsType< Type >
+		{
+			return lhs.GetIdentity() <=> rhs.GetIdentity();
 		}
 
 	private:
-		// publicٰ̿, private óϰ, Լ ؼ ȣϵ մϴ.
-		Nullable( const ElementType& dataElement ) noexcept
-			: m_data{ nullptr }
+		// public이였다가, private으로 처리하고, 전역함수( MakeNullable, EmplaceNullable )를 통해서만 호출하도록 합니다.
+		// 인자들을 그대로 할당되는 메모리에 전달하여, ElementType을 제자리에서 생성합니다.
+		template< typename... Args >
+		explicit Nullable( std::in_place_t, Args&&... args )
+			: m_data{ _MakeNull() }
 		{
 			if constexpr ( IsRawPtr< Type >::value )
 			{
-				m_data = new ElementType( dataElement );
+				m_data = new ElementType( std::forward< Args >( args )... );
 			}
 			else if constexpr ( IsSharedPtr< Type >::value )
 			{
-				// [ ver 0.6 ] 
+				// [ ver 0.6 ] 으악
 				//if constexpr ( std::derived_from< ElementType, std::enable_shared_from_this< ElementType > > )
 				//{
 				//	m_data = dataElement.shared_from_this();
 				//}
 				//else
 				//{
-					m_data = std::make_shared< ElementType >( dataElement );
+					m_data = std::make_shared< ElementType >( std::forward< Args >( args )... );
 				//}
 			}
+			else if constexpr ( IsUniquePtr< Type >::value )
+			{
+				if constexpr ( std::is_same_v< typename IsUniquePtr< Type >::DeleterType, std::default_delete< ElementType > > )
+				{
+					m_data = std::make_unique< ElementType >( std::forward< Args >( args )... );
+				}
+				else
+				{
+					WONSY_FAIL_STATIC_ASSERT( "unique_ptr with a custom deleter must be created with AllocateNullable." );
+				}
+			}
+			else if constexpr ( IsInline< Type >::value )
+			{
+				m_data.Emplace( std::forward< Args >( args )... );
+			}
+			else if constexpr ( IsIntrusivePtr< Type >::value )
+			{
+				m_data = MakeIntrusive< ElementType >( std::forward< Args >( args )... );
+			}
+			else if constexpr ( IsLocalSharedPtr< Type >::value )
+			{
+				m_data = MakeLocalShared< ElementType >( std::forward< Args >( args )... );
+			}
+			else if constexpr ( PointerTraitsMakeable< Type, Args&&... > )
+			{
+				m_data = PointerTraits< Type >::Make( std::forward< Args >( args )... );
+			}
+			else
+			{
+				WONSY_FAIL_STATIC_ASSERT( "unSupported Type! ( define PointerTraits< Type >::Make )" );
+			}
+		}
+
+		// 전역함수( AllocateNullable )를 통해서만 호출하도록 합니다. 전역 힙 대신 alloc에서 ElementType을 할당합니다.
+		template< AllocatorType Alloc, typename... Args >
+		Nullable( std::allocator_arg_t, const Alloc& alloc, Args&&... args )
+			: m_data{ _MakeNull() }
+		{
+			if constexpr ( IsRawPtr< Type >::value )
+			{
+				// 같은 Allocator를 인자로 Release( alloc )를 호출하여 해제해야 합니다.
+				m_data = AllocateElement< ElementType >( alloc, std::forward< Args >( args )... );
+			}
+			else if constexpr ( IsSharedPtr< Type >::value )
+			{
+				m_data = std::allocate_shared< ElementType >( alloc, std::forward< Args >( args )... );
+			}
+			else if constexpr ( IsUniquePtr< Type >::value )
+			{
+				// AllocatorDeleter를 사용하는 unique_ptr만 지원하며, Deleter가 alloc을 기억하므로 Release()로 돌려줍니다.
+				m_data = NotNull< Type >::AllocateNotNull( alloc, std::forward< Args >( args )... ).DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD();
+			}
+			else if constexpr ( IsLocalSharedPtr< Type >::value )
+			{
+				m_data = AllocateLocalShared< ElementType >( alloc, std::forward< Args >( args )... );
+			}
 			else
 			{
 				WONSY_FAIL_STATIC_ASSERT( "unSupported Type!" );
 			}
 		}
 
-		//// ο, m_data ϱ  մϴ.
+		//// 내부에서, m_data를 접근하기 위해 사용합니다.
 		//const Type& _GetData() const noexcept
 		//{
 		//	return m_data;
@@ -172,38 +425,222 @@ namespace WonSY
 #pragma endregion
 
 	public:
-		// Owner , ȣؼ  ޸𸮸 ݴϴ.
+		// Owner일 시, 호출해서 수동으로 메모리를 제거해줍니다.
 		void Release()
 		{
 			if constexpr ( std::is_pointer< Type >::value )
 			{
 				delete m_data;
 			}
+			else if constexpr ( PointerTraitsReleasable< Type > )
+			{
+				PointerTraits< Type >::Release( m_data );
+			}
+
+			/* smart Pointer의 Data반환은 아래 nullptr 할당으로 처리됩니다. ( weak_ptr은 더 이상 관찰하지 않습니다. ) */
+			m_data = _MakeNull();
+		}
+
+		// AllocateNullable로 생성된 Owner일 시, 호출해서 delete 대신 alloc으로 메모리를 돌려줍니다.
+		// ( shared_ptr, LocalSharedPtr은 블록이, unique_ptr은 Deleter가 Allocator를 기억하고 있으므로, Release()와 동일합니다. )
+		template< AllocatorType Alloc >
+		void Release( const Alloc& alloc )
+		{
+			if constexpr ( std::is_pointer< Type >::value )
+			{
+				DeallocateElement( alloc, m_data );
+			}
 
-			/* smart Pointer Dataȯ Ʒ nullptr Ҵ ó˴ϴ. */
-			m_data = nullptr;
+			m_data = _MakeNull();
+		}
+
+		void Release( std::pmr::memory_resource* const resource )
+		{
+			Release( std::pmr::polymorphic_allocator< ElementType >( resource ) );
+		}
+
+		// 가리키는 개체의 Identity( 기본적으로 주소, null은 0 )를 반환합니다. 비교, 해시에서 사용합니다.
+		[[nodiscard]] std::uint64_t GetIdentity() const noexcept
+			requires PointerTraitsType< Type >
+		{
+			return WonSY::GetIdentity( m_data );
+		}
+
+		// T가 TaggedPtr 일 경우, 포인터에 함께 담긴 소유권과 Tag에 접근합니다.
+		bool IsOwner() const noexcept
+			requires IsTaggedPtr< Type >::value
+		{
+			return m_data.IsOwner();
+		}
+
+		template< typename TagType >
+			requires IsTaggedPtr< Type >::value
+		bool HasTag( const TagType tag ) const noexcept
+		{
+			return m_data.HasTag( tag );
+		}
+
+		template< typename TagType >
+			requires IsTaggedPtr< Type >::value
+		void SetTag( const TagType tag, const bool isOn = true ) noexcept
+		{
+			m_data.SetTag( tag, isOn );
 		}
 
 	public:
 		[[nodiscard]] static Nullable< Type > MakeNullable( const ElementType& ele )
 		{
-			return Nullable< Type >( ele );
+			return Nullable< Type >( std::in_place, ele );
 		}
 
-		// ũο  Լ, ̰ ٸ  ȣϴ 찡  Լ ̸ ϰ ۼѴ.
-		[[nodiscard]] NotNull< Type > DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME() const
+		// ElementType의 생성자 인자들을 받아, 복사 없이 바로 생성합니다. ( 복사, 이동이 불가능한 ElementType도 생성할 수 있습니다. )
+		template< typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] static Nullable< Type > EmplaceNullable( Args&&... args )
 		{
-			//  Լ  ȣ ʰ, ũο  ȴٴ 길 ٸ, ⼭ m_data ȿ ȴ.
-			
-			if constexpr ( IsRawPtr< Type >::value || IsSharedPtr< Type >::value ) 
+			return Nullable< Type >( std::in_place, std::forward< Args >( args )... );
+		}
+
+		// alloc에서 ElementType을 할당하여 생성합니다. ( RawPtr은 같은 Allocator로 Release( alloc )를 호출하여 해제합니다. )
+		template< AllocatorType Alloc, typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] static Nullable< Type > AllocateNullable( const Alloc& alloc, Args&&... args )
+		{
+			return Nullable< Type >( std::allocator_arg, alloc, std::forward< Args >( args )... );
+		}
+
+		// memory_resource( 예를 들어 std::pmr::monotonic_buffer_resource )에서 ElementType을 할당하여 생성합니다.
+		template< typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] static Nullable< Type > AllocateNullable( std::pmr::memory_resource* const resource, Args&&... args )
+		{
+			return AllocateNullable( std::pmr::polymorphic_allocator< ElementType >( resource ), std::forward< Args >( args )... );
+		}
+
+		// m_data를 반환하는 함수입니다. ( 다른 Type의 Nullable로의 변환에서 사용합니다. )
+		[[nodiscard]] Type DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() const&
+		{
+			return m_data;
+		}
+
+		// 소멸될 Nullable( rvalue )일 경우, m_data를 복사하지 않고 옮기며 이 nullable은 null이 됩니다.
+		[[nodiscard]] Type DoNotCall_____WON_S_Y_BIRTHDAY_IS_JULY_3RD() && noexcept
+		{
+			return std::exchange( m_data, _MakeNull() );
+		}
+
+		// 매크로에서만 사용할 함수, 확장하기 전에 null을 확인하고 확장할 대상을 반환합니다.
+		// weak_ptr은 여기서 한번만 lock()한 Nullable< shared_ptr >을 반환하므로, null 확인과 확장 사이에 만료되더라도 안전하며 다시 lock()하지 않습니다.
+		// 이외의 Type은 이 nullable 자신의 참조를 반환합니다.
+		[[nodiscard]] decltype( auto ) DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE() const& noexcept( !PointerTraitsPinnable< Type > )
+		{
+			if constexpr ( IsWeakPtr< Type >::value )
+				return Nullable< std::shared_ptr< ElementType > >( m_data.lock() );
+			else if constexpr ( PointerTraitsPinnable< Type > )
+				return PinnedNullable< Type >( *this );
+			else
+				return static_cast< const Nullable& >( *this );
+		}
+
+		// 매크로( EXPAND_TO_NOTNULL_MOVE, 혹은 함수 반환 값 등 임시 nullable의 확장 )에서만 사용할 함수, weak_ptr은 lock()한 이후 이 nullable을 null로 만듭니다.
+		// 임시 nullable은 매크로의 변수 선언이 끝나면 소멸되므로, 참조가 아닌 값으로 옮겨 반환하여 확장한 스코프 동안 유지합니다.
+		[[nodiscard]] auto DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE() && noexcept( !PointerTraitsPinnable< Type > )
+		{
+			if constexpr ( IsWeakPtr< Type >::value )
+				return Nullable< std::shared_ptr< ElementType > >( std::exchange( m_data, _MakeNull() ).lock() );
+			else if constexpr ( PointerTraitsPinnable< Type > )
+				return PinnedNullable< Type >( std::move( *this ) );
+			else
+				return Nullable( std::move( *this ) );
+		}
+
+		// 매크로에서만 사용할 함수, 이걸 다른데에서 직접 호출하는 경우가 없게 함수 이름 끔찍하게 작성한다.
+		// unique_ptr은 소유권을 옮기지 않고, 빌려온 NotNull< ElementType* >를 반환합니다. ( nullable의 스코프 안에서만 사용해야 합니다. )
+		[[nodiscard]] ExpandedNotNullType DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME() const&
+		{
+			// 이 함수를 수동으로 호출하지 않고, 매크로에 의해 실행된다는 룰만 지켜진다면, 여기서는 m_data의 유효성이 인정된다.
+			static_assert( !IsWeakPtr< Type >::value, "weak_ptr is expanded by ARE_YOU_THERE()." );
+
+			if constexpr ( !IsUniquePtr< Type >::value )
 				return NotNull< Type >::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( m_data );
 			// Ver 0.4
 			// else if constexpr ( IsUniquePtr< Type >::value )
 			// 	return NotNull< std::shared_ptr< ElementType > >::MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( m_data );
+			else
+				return NotNull< ElementType* >::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( std::addressof( PointerTraits< Type >::Deref( m_data ) ) );
+		}
+
+		// 확장 대상이 임시 객체( weak_ptr을 lock()한 Nullable< shared_ptr > )일 경우, 복사하지 않고 옮겨서 레퍼런스 카운트를 다시 증가시키지 않습니다.
+		[[nodiscard]] ExpandedNotNullType DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME() && noexcept
+		{
+			if constexpr ( IsUniquePtr< Type >::value )
+				return static_cast< const Nullable& >( *this ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
+			else
+				return std::move( *this ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__TAKE_MY_NAME();
+		}
+
+		// 매크로( EXPAND_TO_NOTNULL_MOVE )에서만 사용할 함수, m_data를 NotNull로 옮기고 이 nullable은 null이 됩니다.
+		[[nodiscard]] NotNullType DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__TAKE_MY_NAME() && noexcept
+		{
+			static_assert( !IsWeakPtr< Type >::value, "weak_ptr is expanded by ARE_YOU_THERE()." );
+
+			return NotNull< Type >::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( std::exchange( m_data, _MakeNull() ) );
+		}
+
+		// 매크로( EXPAND_TO_NOTNULL_REF )에서만 사용할 함수, m_data를 복사하지 않고 빌려온 NotNullRef를 반환합니다.
+		[[nodiscard]] NotNullRef< ElementType > DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__LEND_ME_YOUR_NAME() const noexcept
+		{
+			// 마찬가지로 매크로에 의해 실행된다는 룰만 지켜진다면, 여기서는 m_data의 유효성이 인정된다.
+			static_assert( !IsWeakPtr< Type >::value, "weak_ptr is expanded by ARE_YOU_THERE()." );
+
+			return NotNullRef< ElementType >::DoNotCall_____MY_NAME_IS_NOT_NULL_REF__NICE_TO_MEET_YOU( PointerTraits< Type >::Deref( m_data ) );
+		}
+	};
+
+	// PinnedNullable이 Nullable보다 먼저 생성하도록, Guard를 담는 기반 클래스입니다.
+	template< typename Type >
+	class PinGuardHolder
+	{
+	protected:
+		decltype( PointerTraits< Type >::Pin() ) m_pinGuard = PointerTraits< Type >::Pin();
+	};
+
+	// 매크로에서만 사용하는 확장 대상으로, Pin()의 Guard를 얻은 후에 nullable을 복사( 혹은 이동 )합니다.
+	// 매크로의 변수로 확장한 스코프 동안 유지되며, 확장한 NotNull보다 늦게 소멸되므로 그 동안 Guard가 유지됩니다.
+	template< NullableRequire _Type >
+	class PinnedNullable
+		: private PinGuardHolder< _Type >
+		, public Nullable< _Type >
+	{
+	public:
+		explicit PinnedNullable( const Nullable< _Type >& nullable )
+			: PinGuardHolder< _Type >()
+			, Nullable< _Type >      ( nullable )
+		{
+		}
+
+		explicit PinnedNullable( Nullable< _Type >&& nullable )
+			: PinGuardHolder< _Type >()
+			, Nullable< _Type >      ( std::move( nullable ) )
+		{
 		}
+
+		PinnedNullable( const PinnedNullable& )            = delete;
+		PinnedNullable& operator=( const PinnedNullable& ) = delete;
 	};
 }
 
+// unordered_set, unordered_map의 키로 사용할 수 있도록, Identity로 해시합니다. ( NotNull과 같은 값입니다. )
+template< WonSY::NullableRequire T >
+	requires WonSY::PointerTraitsType< T >
+struct std::hash< WonSY::Nullable< T > >
+{
+	std::size_t operator()( const WonSY::Nullable< T >& nullable ) const noexcept
+	{
+		return std::hash< std::uint64_t >{}( nullable.GetIdentity() );
+	}
+};
+
 template< typename T >
 using WsyNullable = WonSY::Nullable< T >;
 
@@ -213,42 +650,151 @@ using WsyNullableRaw = WonSY::Nullable< WsyRawPtr< T > >;
 template< typename T >
 using WsyNullableShared = WonSY::Nullable< WsySharedPtr< T > >;
 
+template< typename T >
+using WsyNullableUnique = WonSY::Nullable< WsyUniquePtr< T > >;
+
+template< typename T >
+using WsyNullableWeak = WonSY::Nullable< WsyWeakPtr< T > >;
+
+template< typename T >
+using WsyNullableInline = WonSY::Nullable< WsyInline< T > >;
+
+template< typename T >
+using WsyNullableIntrusive = WonSY::Nullable< WsyIntrusivePtr< T > >;
+
+template< typename T >
+using WsyNullableLocalShared = WonSY::Nullable< WsyLocalSharedPtr< T > >;
+
+template< typename T, typename TagType = std::size_t >
+using WsyNullableTagged = WonSY::Nullable< WsyTaggedPtr< T, TagType > >;
+
 #define RETURN_VOID (void)(0)
 
-#define __NOTNULL__TYPE__( X ) WonSY::NotNull< typename std::remove_pointer_t< typename std::remove_reference_t< typename std::remove_const_t< decltype( X ) > > >::Type >
+// 확장 대상( ARE_YOU_THERE )을 담는 변수 이름입니다. ( weak_ptr은 lock()한 shared_ptr을, 확장한 스코프 동안 유지합니다. )
+#define __NULLABLE__EXPANDING__( notNullName ) notNullName##_WonSY_Expanding
+
+#define __NOTNULL__TYPE__( X ) typename std::remove_pointer_t< typename std::remove_reference_t< typename std::remove_const_t< decltype( X ) > > >::ExpandedNotNullType
+
+#define __NOTNULL_MOVE__TYPE__( X ) typename std::remove_pointer_t< typename std::remove_reference_t< typename std::remove_const_t< decltype( X ) > > >::NotNullType
+
+#define __NOTNULL_REF__TYPE__( X ) WonSY::NotNullRef< typename std::remove_pointer_t< typename std::remove_reference_t< typename std::remove_const_t< decltype( X ) > > >::ElementType >
 
 #define EXPAND_TO_NOTNULL( nullableName, notNullName, If_Fail_ReturnValue ) \
-	if ( !nullableName ) [[unlikely]]                        \
-	{                                                        \
-		return If_Fail_ReturnValue;                          \
-	}                                                        \
-	                                                         \
-	__NOTNULL__TYPE__( nullableName ) notNullName = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                            \
+	{                                                                                                                      \
+		return If_Fail_ReturnValue;                                                                                        \
+	}                                                                                                                      \
+	                                                                                                                       \
+	__NOTNULL__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = std::forward< decltype( __NULLABLE__EXPANDING__( notNullName ) ) >( __NULLABLE__EXPANDING__( notNullName ) ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
 
 #define EXPAND_TO_NOTNULL_EX( nullableName, notNullName, If_Fail_ReturnValue, If_Fail_Task )  \
-	if ( !nullableName ) [[unlikely]]                                    \
-	{                                                                    \
-		If_Fail_Task                                                     \
-		return If_Fail_ReturnValue;                                      \
-	}                                                                    \
-	                                                                     \
-	__NOTNULL__TYPE__( nullableName ) notNullName = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                            \
+	{                                                                                                                      \
+		If_Fail_Task                                                                                                       \
+		return If_Fail_ReturnValue;                                                                                        \
+	}                                                                                                                      \
+	                                                                                                                       \
+	__NOTNULL__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = std::forward< decltype( __NULLABLE__EXPANDING__( notNullName ) ) >( __NULLABLE__EXPANDING__( notNullName ) ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
 
 #define EXPAND_TO_NOTNULL_CONTINUE( nullableName, notNullName ) \
-	if ( !nullableName ) [[unlikely]]       \
-	{                                       \
-		continue;                           \
-	}                                       \
-	                                        \
-	__NOTNULL__TYPE__( nullableName ) notNullName = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                            \
+	{                                                                                                                      \
+		continue;                                                                                                          \
+	}                                                                                                                      \
+	                                                                                                                       \
+	__NOTNULL__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = std::forward< decltype( __NULLABLE__EXPANDING__( notNullName ) ) >( __NULLABLE__EXPANDING__( notNullName ) ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
 
 #define EXPAND_TO_NOTNULL_CONTINUE_EX( nullableName, notNullName, If_Fail_Task ) \
-	if ( !nullableName ) [[unlikely]]       \
-	{                                       \
-		If_Fail_Task                        \
-		continue;                           \
-	}                                       \
-	                                        \
-	__NOTNULL__TYPE__( nullableName ) notNullName = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                            \
+	{                                                                                                                      \
+		If_Fail_Task                                                                                                       \
+		continue;                                                                                                          \
+	}                                                                                                                      \
+	                                                                                                                       \
+	__NOTNULL__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = std::forward< decltype( __NULLABLE__EXPANDING__( notNullName ) ) >( __NULLABLE__EXPANDING__( notNullName ) ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
+
+// 아래 _REF 매크로들은 NotNull 대신 빌려온 NotNullRef를 생성하므로, 레퍼런스 카운트가 변하지 않습니다. ( weak_ptr은 lock() 한번만 증가합니다. )
+// 대신 notNullName은 nullableName의 스코프 안에서만 사용해야 합니다.
+#define EXPAND_TO_NOTNULL_REF( nullableName, notNullName, If_Fail_ReturnValue ) \
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                            \
+	{                                                                                                                      \
+		return If_Fail_ReturnValue;                                                                                        \
+	}                                                                                                                      \
+	                                                                                                                       \
+	__NOTNULL_REF__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = __NULLABLE__EXPANDING__( notNullName ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__LEND_ME_YOUR_NAME();
+
+#define EXPAND_TO_NOTNULL_REF_EX( nullableName, notNullName, If_Fail_ReturnValue, If_Fail_Task )  \
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                            \
+	{                                                                                                                      \
+		If_Fail_Task                                                                                                       \
+		return If_Fail_ReturnValue;                                                                                        \
+	}                                                                                                                      \
+	                                                                                                                       \
+	__NOTNULL_REF__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = __NULLABLE__EXPANDING__( notNullName ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__LEND_ME_YOUR_NAME();
+
+#define EXPAND_TO_NOTNULL_REF_CONTINUE( nullableName, notNullName ) \
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                            \
+	{                                                                                                                      \
+		continue;                                                                                                          \
+	}                                                                                                                      \
+	                                                                                                                       \
+	__NOTNULL_REF__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = __NULLABLE__EXPANDING__( notNullName ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__LEND_ME_YOUR_NAME();
+
+#define EXPAND_TO_NOTNULL_REF_CONTINUE_EX( nullableName, notNullName, If_Fail_Task ) \
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = nullableName.DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                            \
+	{                                                                                                                      \
+		If_Fail_Task                                                                                                       \
+		continue;                                                                                                          \
+	}                                                                                                                      \
+	                                                                                                                       \
+	__NOTNULL_REF__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = __NULLABLE__EXPANDING__( notNullName ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__LEND_ME_YOUR_NAME();
+
+// 아래 _MOVE 매크로들은 nullableName의 데이터를 복사하지 않고 NotNull로 옮깁니다. ( 레퍼런스 카운트가 변하지 않습니다. )
+// 확장이 성공하면 nullableName은 null이 됩니다.
+#define EXPAND_TO_NOTNULL_MOVE( nullableName, notNullName, If_Fail_ReturnValue ) \
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = std::move( nullableName ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                                         \
+	{                                                                                                                                   \
+		return If_Fail_ReturnValue;                                                                                                     \
+	}                                                                                                                                   \
+	                                                                                                                                    \
+	__NOTNULL_MOVE__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = std::move( __NULLABLE__EXPANDING__( notNullName ) ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__TAKE_MY_NAME();
+
+#define EXPAND_TO_NOTNULL_MOVE_EX( nullableName, notNullName, If_Fail_ReturnValue, If_Fail_Task )  \
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = std::move( nullableName ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                                         \
+	{                                                                                                                                   \
+		If_Fail_Task                                                                                                                    \
+		return If_Fail_ReturnValue;                                                                                                     \
+	}                                                                                                                                   \
+	                                                                                                                                    \
+	__NOTNULL_MOVE__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = std::move( __NULLABLE__EXPANDING__( notNullName ) ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__TAKE_MY_NAME();
+
+#define EXPAND_TO_NOTNULL_MOVE_CONTINUE( nullableName, notNullName ) \
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = std::move( nullableName ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                                         \
+	{                                                                                                                                   \
+		continue;                                                                                                                       \
+	}                                                                                                                                   \
+	                                                                                                                                    \
+	__NOTNULL_MOVE__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = std::move( __NULLABLE__EXPANDING__( notNullName ) ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__TAKE_MY_NAME();
+
+#define EXPAND_TO_NOTNULL_MOVE_CONTINUE_EX( nullableName, notNullName, If_Fail_Task ) \
+	auto&& __NULLABLE__EXPANDING__( notNullName ) = std::move( nullableName ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__ARE_YOU_THERE(); \
+	if ( !__NULLABLE__EXPANDING__( notNullName ) ) [[unlikely]]                                                                         \
+	{                                                                                                                                   \
+		If_Fail_Task                                                                                                                    \
+		continue;                                                                                                                       \
+	}                                                                                                                                   \
+	                                                                                                                                    \
+	__NOTNULL_MOVE__TYPE__( __NULLABLE__EXPANDING__( notNullName ) ) notNullName = std::move( __NULLABLE__EXPANDING__( notNullName ) ).DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__TAKE_MY_NAME();
 
 #endif
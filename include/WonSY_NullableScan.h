@@ -0,0 +1,329 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_NULLABLE_SCAN
+#define WONSY_NULLABLE_SCAN
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_Nullable.h"
+
+// x64에서만 SIMD 경로를 사용합니다. ( WONSY_NULLABLE_SCAN_DISABLE_SIMD를 정의하면 항상 스칼라 경로를 사용합니다. )
+#if !defined( WONSY_NULLABLE_SCAN_DISABLE_SIMD ) && ( defined( __x86_64__ ) || defined( _M_X64 ) )
+	#define WONSY_NULLABLE_SCAN_SIMD 1
+
+	#include <immintrin.h>
+
+	#if defined( _MSC_VER ) && !defined( __clang__ )
+		#include <intrin.h>
+		#define WONSY_TARGET_AVX2
+	#else
+		#define WONSY_TARGET_AVX2 __attribute__( ( target( "avx2" ) ) )
+	#endif
+#else
+	#define WONSY_NULLABLE_SCAN_SIMD 0
+#endif
+
+
+namespace WonSY
+{
+	/*
+		Nullable< T* >의 배열에서 null을 한번에 확인하고, 유효한 요소들만 모으는 함수들입니다.
+
+		대부분이 null인 배열을 순회하며 요소마다 operator bool()로 확인하면, 예측하기 어려운 분기가 요소 수만큼 발생합니다.
+		아래 함수들은 포인터들을 SIMD로 한번에 0과 비교하여 64개 단위의 비트 마스크를 만들고, 이후의 처리는 마스크로 진행합니다.
+
+			- BuildNotNullMask( nullables, outMask ) : 요소 i가 유효하면 outMask[ i / 64 ]의 i % 64번째 비트가 1인 마스크를 만듭니다.
+			- CountNotNull( nullables )              : 유효한 요소의 수를 반환합니다. ( 마스크의 popcount )
+			- CompactNotNullIndices( nullables, out ) : 유효한 요소들의 인덱스를 out의 앞에서부터 채우고, 채운 수를 반환합니다.
+			- CompactNotNull( nullables, out )       : 유효한 요소들을 NotNull< T* >로 out( output iterator )에 넣습니다.
+			- 경로는 처음 호출 시 CPU를 확인하여 AVX2, SSE2( x64의 기본 ), 스칼라 순으로 선택됩니다. ( GetNullableScanPath )
+			- 스칼라 경로도 요소마다 분기하지 않고, 비교 결과를 비트로 모읍니다.
+
+		주의 해야할 것은,
+			- Nullable< T* >만 지원합니다. ( 포인터 하나의 크기인 Nullable의 메모리를 직접 읽습니다. )
+			- 모은 인덱스와 NotNull은 스캔한 시점의 결과이므로, 이후 원본을 수정하면 다시 스캔해야 합니다.
+			- CompactNotNullIndices의 out은 유효한 요소의 수 이상의 크기여야 합니다. ( nullables.size()로 잡으면 항상 충분합니다. )
+
+		[ Version ]
+		// 0.1
+			- 대부분이 null인 Nullable< T* > 배열의 순회에서 발생하는 분기 예측 실패를 줄이기 위해, SIMD 마스크 기반의 스캔과 압축을 추가하였습니다.
+	*/
+
+	enum class NullableScanPath
+	{
+		Scalar,
+		Sse2,
+		Avx2
+	};
+
+	namespace Detail
+	{
+		inline constexpr std::size_t MaskBitCount = 64;
+
+		[[nodiscard]] inline std::uintptr_t LoadPointerBits( const std::byte* const data, const std::size_t index ) noexcept
+		{
+			std::uintptr_t bits;
+			std::memcpy( &bits, data + index * sizeof( std::uintptr_t ), sizeof( std::uintptr_t ) );
+			return bits;
+		}
+
+		// 마스크 한 word( 최대 64개 )를 분기 없이 만듭니다.
+		[[nodiscard]] inline std::uint64_t BuildMaskWordScalar( const std::byte* const data, const std::size_t count ) noexcept
+		{
+			std::uint64_t mask = 0;
+			for ( std::size_t index = 0; index < count; ++index )
+				mask |= static_cast< std::uint64_t >( LoadPointerBits( data, index ) != 0 ) << index;
+
+			return mask;
+		}
+
+#if WONSY_NULLABLE_SCAN_SIMD
+		// 포인터 2개씩 비교합니다. ( SSE2에는 64비트 비교가 없으므로, 32비트 비교 결과의 상위, 하위를 합칩니다. )
+		[[nodiscard]] inline std::uint64_t BuildMaskWordSse2( const std::byte* const data ) noexcept
+		{
+			const __m128i zero = _mm_setzero_si128();
+
+			std::uint64_t mask = 0;
+			for ( std::size_t index = 0; index < MaskBitCount; index += 2 )
+			{
+				const __m128i pointers = _mm_loadu_si128( reinterpret_cast< const __m128i* >( data + index * sizeof( std::uintptr_t ) ) );
+				const __m128i equal32  = _mm_cmpeq_epi32( pointers, zero );
+				const __m128i equal64  = _mm_and_si128( equal32, _mm_shuffle_epi32( equal32, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+				const auto nullBits = static_cast< std::uint64_t >( _mm_movemask_pd( _mm_castsi128_pd( equal64 ) ) );
+				mask |= ( ~nullBits & 0x3 ) << index;
+			}
+
+			return mask;
+		}
+
+		// 포인터 4개씩 비교합니다.
+		[[nodiscard]] WONSY_TARGET_AVX2 inline std::uint64_t BuildMaskWordAvx2( const std::byte* const data ) noexcept
+		{
+			const __m256i zero = _mm256_setzero_si256();
+
+			std::uint64_t mask = 0;
+			for ( std::size_t index = 0; index < MaskBitCount; index += 4 )
+			{
+				const __m256i pointers = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( data + index * sizeof( std::uintptr_t ) ) );
+				const __m256i equal64  = _mm256_cmpeq_epi64( pointers, zero );
+
+				const auto nullBits = static_cast< std::uint64_t >( _mm256_movemask_pd( _mm256_castsi256_pd( equal64 ) ) );
+				mask |= ( ~nullBits & 0xF ) << index;
+			}
+
+			return mask;
+		}
+
+		WONSY_TARGET_AVX2 inline void BuildMaskAvx2( const std::byte* const data, const std::size_t fullWordCount, std::uint64_t* const outMask ) noexcept
+		{
+			for ( std::size_t word = 0; word < fullWordCount; ++word )
+				outMask[ word ] = BuildMaskWordAvx2( data + word * MaskBitCount * sizeof( std::uintptr_t ) );
+		}
+
+		[[nodiscard]] inline bool IsAvx2Supported() noexcept
+		{
+	#if defined( _MSC_VER ) && !defined( __clang__ )
+			int info[ 4 ];
+			__cpuid( info, 0 );
+			if ( info[ 0 ] < 7 )
+				return false;
+
+			// OS가 AVX 레지스터( YMM )를 저장하는지도 확인합니다.
+			__cpuid( info, 1 );
+			const bool isOsxsave = ( info[ 2 ] & ( 1 << 27 ) ) != 0;
+			const bool isAvx     = ( info[ 2 ] & ( 1 << 28 ) ) != 0;
+			if ( !isOsxsave || !isAvx || ( _xgetbv( 0 ) & 0x6 ) != 0x6 )
+				return false;
+
+			__cpuidex( info, 7, 0 );
+			return ( info[ 1 ] & ( 1 << 5 ) ) != 0;
+	#else
+			__builtin_cpu_init();
+			return __builtin_cpu_supports( "avx2" );
+	#endif
+		}
+#endif
+
+		[[nodiscard]] inline NullableScanPath DetectNullableScanPath() noexcept
+		{
+#if WONSY_NULLABLE_SCAN_SIMD
+			return IsAvx2Supported() ? NullableScanPath::Avx2 : NullableScanPath::Sse2;
+#else
+			return NullableScanPath::Scalar;
+#endif
+		}
+	}
+
+	// 이 프로세스에서 사용하는 경로입니다. ( 처음 호출 시 한 번만 확인합니다. )
+	[[nodiscard]] inline NullableScanPath GetNullableScanPath() noexcept
+	{
+		static const NullableScanPath s_path = Detail::DetectNullableScanPath();
+		return s_path;
+	}
+
+	// count개의 요소에 필요한 마스크의 word 수입니다.
+	[[nodiscard]] constexpr std::size_t GetNotNullMaskSize( const std::size_t count ) noexcept
+	{
+		return ( count + Detail::MaskBitCount - 1 ) / Detail::MaskBitCount;
+	}
+
+	template < typename T >
+	class IsNullableRaw
+		: public std::false_type
+	{
+	};
+
+	template < typename T >
+	class IsNullableRaw< Nullable< T* > >
+		: public std::true_type
+	{
+	public:
+		using ElementType = T;
+	};
+
+	// std::vector< Nullable< T* > >, std::array, std::span 등 Nullable< T* >가 연속된 range입니다.
+	template < class R >
+	concept NullableRawRange = std::ranges::contiguous_range< R > && std::ranges::sized_range< R > && IsNullableRaw< std::remove_cv_t< std::ranges::range_value_t< R > > >::value;
+
+	template < NullableRawRange R >
+	using NullableRawElementType = IsNullableRaw< std::remove_cv_t< std::ranges::range_value_t< R > > >::ElementType;
+
+	namespace Detail
+	{
+		template < NullableRawRange R >
+		[[nodiscard]] const std::byte* GetNullableRawData( const R& nullables ) noexcept
+		{
+			using NullableType = Nullable< NullableRawElementType< R >* >;
+			static_assert( sizeof( NullableType ) == sizeof( std::uintptr_t ) && std::is_standard_layout_v< NullableType >, "Nullable< T* > must have the layout of T*." );
+
+			return reinterpret_cast< const std::byte* >( std::ranges::data( nullables ) );
+		}
+
+		inline void BuildMask( const std::byte* const data, const std::size_t count, std::uint64_t* const outMask ) noexcept
+		{
+			const std::size_t fullWordCount = count / MaskBitCount;
+			const std::size_t restCount     = count % MaskBitCount;
+
+			switch ( GetNullableScanPath() )
+			{
+#if WONSY_NULLABLE_SCAN_SIMD
+			case NullableScanPath::Avx2:
+				BuildMaskAvx2( data, fullWordCount, outMask );
+				break;
+
+			case NullableScanPath::Sse2:
+				for ( std::size_t word = 0; word < fullWordCount; ++word )
+					outMask[ word ] = BuildMaskWordSse2( data + word * MaskBitCount * sizeof( std::uintptr_t ) );
+				break;
+#endif
+			default:
+				for ( std::size_t word = 0; word < fullWordCount; ++word )
+					outMask[ word ] = BuildMaskWordScalar( data + word * MaskBitCount * sizeof( std::uintptr_t ), MaskBitCount );
+				break;
+			}
+
+			// 64개로 나누어 떨어지지 않는 나머지는 스칼라로 처리합니다.
+			if ( restCount )
+				outMask[ fullWordCount ] = BuildMaskWordScalar( data + fullWordCount * MaskBitCount * sizeof( std::uintptr_t ), restCount );
+		}
+
+		// func( wordIndex, mask )를 64개 단위로 호출합니다. 마스크는 스택의 버퍼에 나누어 만들어지므로, 할당이 없습니다.
+		template< typename Func >
+		void ForEachMaskWord( const std::byte* const data, const std::size_t count, Func&& func )
+		{
+			constexpr std::size_t BufferWordCount = 32;
+			constexpr std::size_t ChunkSize       = BufferWordCount * MaskBitCount;
+
+			std::uint64_t buffer[ BufferWordCount ];
+			for ( std::size_t offset = 0; offset < count; offset += ChunkSize )
+			{
+				const std::size_t chunkSize = std::min( ChunkSize, count - offset );
+				BuildMask( data + offset * sizeof( std::uintptr_t ), chunkSize, buffer );
+
+				const std::size_t wordCount = GetNotNullMaskSize( chunkSize );
+				for ( std::size_t word = 0; word < wordCount; ++word )
+					func( offset / MaskBitCount + word, buffer[ word ] );
+			}
+		}
+	}
+
+	// 요소 i가 유효하면 outMask[ i / 64 ]의 i % 64번째 비트가 1입니다. ( 마지막 word의 남는 비트는 0입니다. )
+	template< NullableRawRange R >
+	void BuildNotNullMask( const R& nullables, const std::span< std::uint64_t > outMask ) noexcept
+	{
+		assert( outMask.size() >= GetNotNullMaskSize( std::ranges::size( nullables ) ) && "outMask is too small" );
+
+		Detail::BuildMask( Detail::GetNullableRawData( nullables ), std::ranges::size( nullables ), outMask.data() );
+	}
+
+	template< NullableRawRange R >
+	[[nodiscard]] std::size_t CountNotNull( const R& nullables ) noexcept
+	{
+		std::size_t count = 0;
+		Detail::ForEachMaskWord( Detail::GetNullableRawData( nullables ), std::ranges::size( nullables ), [ &count ]( std::size_t, const std::uint64_t mask ) noexcept
+			{
+				count += static_cast< std::size_t >( std::popcount( mask ) );
+			} );
+
+		return count;
+	}
+
+	// 유효한 요소들의 인덱스를 오름차순으로 outIndices에 채우고, 채운 수를 반환합니다.
+	template< NullableRawRange R, std::unsigned_integral IndexType >
+	std::size_t CompactNotNullIndices( const R& nullables, const std::span< IndexType > outIndices ) noexcept
+	{
+		std::size_t count = 0;
+		Detail::ForEachMaskWord( Detail::GetNullableRawData( nullables ), std::ranges::size( nullables ), [ &count, outIndices ]( const std::size_t wordIndex, std::uint64_t mask ) noexcept
+			{
+				assert( count + static_cast< std::size_t >( std::popcount( mask ) ) <= outIndices.size() && "outIndices is too small" );
+
+				const std::size_t base = wordIndex * Detail::MaskBitCount;
+				for ( ; mask; mask &= mask - 1 )
+					outIndices[ count++ ] = static_cast< IndexType >( base + static_cast< std::size_t >( std::countr_zero( mask ) ) );
+			} );
+
+		return count;
+	}
+
+	// 유효한 요소들을 NotNull< T* >로 out에 넣고, 마지막 위치의 out을 반환합니다.
+	template< NullableRawRange R, std::output_iterator< NotNull< NullableRawElementType< R >* > > Out >
+	Out CompactNotNull( const R& nullables, Out out )
+	{
+		const auto* const first = std::ranges::data( nullables );
+
+		Detail::ForEachMaskWord( Detail::GetNullableRawData( nullables ), std::ranges::size( nullables ), [ &out, first ]( const std::size_t wordIndex, std::uint64_t mask )
+			{
+				const std::size_t base = wordIndex * Detail::MaskBitCount;
+				for ( ; mask; mask &= mask - 1 )
+				{
+					// 마스크로 유효함이 확인된 요소만 확장합니다.
+					*out = first[ base + static_cast< std::size_t >( std::countr_zero( mask ) ) ].DoNotCall_____HELLO_MY_NAME_IS_NULLABLE__WHAT_IS_YOUR_NAME();
+					++out;
+				}
+			} );
+
+		return out;
+	}
+}
+
+#endif
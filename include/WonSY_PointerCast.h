@@ -0,0 +1,249 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_POINTER_CAST
+#define WONSY_POINTER_CAST
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull, Nullable을 다른 ElementType으로 캐스트하는 StaticCast, DynamicCast, ConstCast입니다. ( std::static_pointer_cast 등과 같은 역할입니다. )
+
+		Derived에서 Base로의 업캐스트는 NotNull, Nullable의 암시적 변환으로 처리되며, 이외의 캐스트에 사용합니다.
+		NotNull을 벗기고 다시 감싸는 과정 없이, 레퍼런스 카운트 변화를 최소화합니다.
+
+			- NotNull의 StaticCast, ConstCast는 null이 될 수 없으므로 NotNull을, 실패할 수 있는 DynamicCast는 Nullable을 반환합니다.
+			- shared_ptr은 별칭 생성자( aliasing constructor )로 컨트롤 블록을 공유하므로, 추가 할당이 없습니다.
+			- rvalue를 인자로 받으면 복사하지 않고 옮기므로, 레퍼런스 카운트가 변하지 않습니다. ( 옮겨진 nullable은 null이 됩니다. )
+			- DynamicCast가 실패하면, rvalue로 받은 원본도 그대로 유지됩니다.
+
+		주의 해야할 것은,
+			- RawPointer, shared_ptr, unique_ptr( 기본 Deleter )을 지원합니다.
+			- unique_ptr은 rvalue의 StaticCast, ConstCast만 지원합니다. ( 소유권이 옮겨지며, Base로 해제되는 경우 가상 소멸자가 필요합니다. )
+
+		[ Version ]
+		// 0.1
+			- 다른 ElementType의 NotNull, Nullable로 바꿀 때 풀고 다시 감싸지 않도록, StaticCast, DynamicCast, ConstCast를 추가하였습니다.
+	*/
+
+	template < typename T, typename To >
+	class RebindPointer
+	{
+	public:
+		using Type = InvalidType;
+	};
+
+	template < typename T, typename To >
+	class RebindPointer< T*, To >
+	{
+	public:
+		using Type = To*;
+	};
+
+	template < typename T, typename To >
+	class RebindPointer< std::shared_ptr< T >, To >
+	{
+	public:
+		using Type = std::shared_ptr< To >;
+	};
+
+	template < typename T, typename To >
+	class RebindPointer< std::unique_ptr< T >, To >
+	{
+	public:
+		using Type = std::unique_ptr< To >;
+	};
+
+	template < typename T, typename To >
+	using RebindPointerType = typename RebindPointer< T, To >::Type;
+
+	enum class PointerCastKind
+	{
+		Static,
+		Dynamic,
+		Const
+	};
+
+	class PointerCast
+	{
+	public:
+		template< PointerCastKind Kind, typename To, typename Type >
+		[[nodiscard]] static auto CastNotNull( const NotNull< Type >& notNull )
+		{
+			return _WrapNotNull< Kind >( _CastData< Kind, To >( notNull.m_data ) );
+		}
+
+		template< PointerCastKind Kind, typename To, typename Type >
+		[[nodiscard]] static auto CastNotNull( NotNull< Type >&& notNull )
+		{
+			return _WrapNotNull< Kind >( _CastData< Kind, To >( std::move( notNull.m_data ) ) );
+		}
+
+		template< PointerCastKind Kind, typename To, typename Type >
+		[[nodiscard]] static Nullable< RebindPointerType< Type, To > > CastNullable( const Nullable< Type >& nullable )
+		{
+			return Nullable< RebindPointerType< Type, To > >( _CastData< Kind, To >( nullable.m_data ) );
+		}
+
+		template< PointerCastKind Kind, typename To, typename Type >
+		[[nodiscard]] static Nullable< RebindPointerType< Type, To > > CastNullable( Nullable< Type >&& nullable )
+		{
+			Nullable< RebindPointerType< Type, To > > result( _CastData< Kind, To >( std::move( nullable.m_data ) ) );
+
+			// 성공한 경우, RawPointer도 옮겨진 것으로 보고 원본을 null로 만듭니다. ( Nullable의 이동과 동일합니다. )
+			if ( result )
+				nullable = nullptr;
+
+			return result;
+		}
+
+	private:
+		template< PointerCastKind Kind >
+		[[nodiscard]] static auto _WrapNotNull( auto&& data )
+		{
+			using ResultType = std::remove_cvref_t< decltype( data ) >;
+
+			if constexpr ( Kind == PointerCastKind::Dynamic )
+				return Nullable< ResultType >( std::move( data ) );
+			else
+				return NotNull< ResultType >::DoNotCall_____MY_NAME_IS_NOT_NULL__NICE_TO_MEET_YOU( std::move( data ) );
+		}
+
+		template< PointerCastKind Kind, typename To, typename From >
+		[[nodiscard]] static To* _CastRaw( From* const raw ) noexcept
+		{
+			if constexpr ( Kind == PointerCastKind::Static )
+				return static_cast< To* >( raw );
+			else if constexpr ( Kind == PointerCastKind::Dynamic )
+				return dynamic_cast< To* >( raw );
+			else
+				return const_cast< To* >( raw );
+		}
+
+		// data가 rvalue일 경우, 캐스트에 성공했을 때만 옮겨옵니다.
+		template< PointerCastKind Kind, typename To, typename Data >
+		[[nodiscard]] static RebindPointerType< std::remove_cvref_t< Data >, To > _CastData( Data&& data ) noexcept
+		{
+			using Type       = std::remove_cvref_t< Data >;
+			using ResultType = RebindPointerType< Type, To >;
+
+			if constexpr ( IsRawPtr< Type >::value )
+			{
+				return _CastRaw< Kind, To >( data );
+			}
+			else if constexpr ( IsSharedPtr< Type >::value )
+			{
+				To* const raw = _CastRaw< Kind, To >( data.get() );
+				if ( !raw )
+					return ResultType();
+
+				return ResultType( std::forward< Data >( data ), raw );
+			}
+			else if constexpr ( IsUniquePtr< Type >::value && std::is_same_v< ResultType, std::unique_ptr< To > > )
+			{
+				if constexpr ( std::is_lvalue_reference_v< Data > || Kind == PointerCastKind::Dynamic )
+				{
+					WONSY_FAIL_STATIC_ASSERT( "unique_ptr supports StaticCast and ConstCast from rvalue only." );
+				}
+				else
+				{
+					return ResultType( _CastRaw< Kind, To >( data.release() ) );
+				}
+			}
+			else
+			{
+				WONSY_FAIL_STATIC_ASSERT( "unSupported Type!" );
+			}
+		}
+	};
+
+	template< typename To, typename Type >
+	[[nodiscard]] NotNull< RebindPointerType< Type, To > > StaticCast( const NotNull< Type >& notNull )
+	{
+		return PointerCast::CastNotNull< PointerCastKind::Static, To >( notNull );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] NotNull< RebindPointerType< Type, To > > StaticCast( NotNull< Type >&& notNull )
+	{
+		return PointerCast::CastNotNull< PointerCastKind::Static, To >( std::move( notNull ) );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] Nullable< RebindPointerType< Type, To > > StaticCast( const Nullable< Type >& nullable )
+	{
+		return PointerCast::CastNullable< PointerCastKind::Static, To >( nullable );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] Nullable< RebindPointerType< Type, To > > StaticCast( Nullable< Type >&& nullable )
+	{
+		return PointerCast::CastNullable< PointerCastKind::Static, To >( std::move( nullable ) );
+	}
+
+	// 실패할 수 있으므로, NotNull에서도 Nullable을 반환합니다.
+	template< typename To, typename Type >
+	[[nodiscard]] Nullable< RebindPointerType< Type, To > > DynamicCast( const NotNull< Type >& notNull )
+	{
+		return PointerCast::CastNotNull< PointerCastKind::Dynamic, To >( notNull );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] Nullable< RebindPointerType< Type, To > > DynamicCast( NotNull< Type >&& notNull )
+	{
+		return PointerCast::CastNotNull< PointerCastKind::Dynamic, To >( std::move( notNull ) );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] Nullable< RebindPointerType< Type, To > > DynamicCast( const Nullable< Type >& nullable )
+	{
+		return PointerCast::CastNullable< PointerCastKind::Dynamic, To >( nullable );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] Nullable< RebindPointerType< Type, To > > DynamicCast( Nullable< Type >&& nullable )
+	{
+		return PointerCast::CastNullable< PointerCastKind::Dynamic, To >( std::move( nullable ) );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] NotNull< RebindPointerType< Type, To > > ConstCast( const NotNull< Type >& notNull )
+	{
+		return PointerCast::CastNotNull< PointerCastKind::Const, To >( notNull );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] NotNull< RebindPointerType< Type, To > > ConstCast( NotNull< Type >&& notNull )
+	{
+		return PointerCast::CastNotNull< PointerCastKind::Const, To >( std::move( notNull ) );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] Nullable< RebindPointerType< Type, To > > ConstCast( const Nullable< Type >& nullable )
+	{
+		return PointerCast::CastNullable< PointerCastKind::Const, To >( nullable );
+	}
+
+	template< typename To, typename Type >
+	[[nodiscard]] Nullable< RebindPointerType< Type, To > > ConstCast( Nullable< Type >&& nullable )
+	{
+		return PointerCast::CastNullable< PointerCastKind::Const, To >( std::move( nullable ) );
+	}
+}
+
+#endif
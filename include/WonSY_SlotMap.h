@@ -0,0 +1,341 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_SLOT_MAP
+#define WONSY_SLOT_MAP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "WonSY_TypeUtil.h"
+#include "WonSY_NotNull.h"
+#include "WonSY_Nullable.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull< SlotHandle< T > >, Nullable< SlotHandle< T > >로 사용하는, 세대( generation ) 기반의 SlotMap과 핸들입니다.
+
+		Nullable< T* >는 Release() 이후 다른 복사본이 댕글링될 수 있고, 이를 피하려면 shared_ptr의 레퍼런스 카운트 비용이 필요합니다.
+		SlotHandle은 ( index, generation ) 32 + 32비트로, 개체가 제거되면 slot의 generation이 증가하므로
+		이전 핸들은 레퍼런스 카운트 없이 O( 1 )로 null이 됩니다. ( EXPAND_TO_NOTNULL에서 실패합니다. )
+
+			- ElementType들은 하나의 vector에 빈틈 없이( dense ) 저장되므로, GetValues()로 선형 순회할 수 있습니다.
+			- 핸들은 SlotMap< T, Tag >::GetInstance()를 가리킵니다. 같은 T로 여러 SlotMap이 필요한 경우 Tag로 구분합니다.
+			- MakeNullable, EmplaceNullable은 SlotMap에 생성하며, Nullable::Release()는 SlotMap에서 제거합니다.
+
+		주의 해야할 것은,
+			- SlotMap은 스레드에 안전하지 않습니다. 한 스레드( 혹은 동기화된 영역 )에서만 사용해주세요.
+			- 생성, 제거 시 ElementType들이 이동되므로, ElementType은 이동 가능해야 하며
+			  확장한 NotNull에서 얻은 ElementType&는 같은 SlotMap에 생성, 제거가 일어나기 전까지만 사용해야 합니다.
+			- NotNull< SlotHandle >은 확장한 스코프 안에서만 유효합니다. ( 제거된 이후의 접근은 디버그 빌드에서 assert로 확인합니다. )
+
+		[ Version ]
+		// 0.1
+			- 레퍼런스 카운트 없이 댕글링을 막기 위해, 세대 기반 SlotMap과 SlotHandle을 추가하였습니다.
+
+		// 0.2
+			- NotNull, Nullable의 비교, 해시가 ElementType의 주소 대신 핸들의 값을 사용하도록, GetKey()와 PointerTraits::Identity를 추가하였습니다.
+	*/
+
+	template < typename T, typename Tag = void >
+	class SlotMap;
+
+	template < typename T, typename Tag = void >
+	class SlotHandle
+	{
+		friend class SlotMap< T, Tag >;
+
+	public:
+		using element_type = T;
+
+		static constexpr std::uint32_t InvalidIndex = std::numeric_limits< std::uint32_t >::max();
+
+	private:
+		std::uint32_t m_index;
+		std::uint32_t m_generation;
+
+		SlotHandle( const std::uint32_t index, const std::uint32_t generation ) noexcept
+			: m_index     { index      }
+			, m_generation{ generation }
+		{
+		}
+
+	public:
+		SlotHandle() noexcept
+			: SlotHandle( InvalidIndex, 0 )
+		{
+		}
+
+		SlotHandle( std::nullptr_t ) noexcept
+			: SlotHandle( InvalidIndex, 0 )
+		{
+		}
+
+		SlotHandle& operator=( std::nullptr_t ) noexcept
+		{
+			m_index      = InvalidIndex;
+			m_generation = 0;
+			return *this;
+		}
+
+		// SlotMap에서 제거되었다면, nullptr을 반환합니다.
+		T* get() const noexcept
+		{
+			return SlotMap< T, Tag >::GetInstance().Find( *this );
+		}
+
+		T& operator*() const noexcept
+		{
+			return *get();
+		}
+
+		T* operator->() const noexcept
+		{
+			return get();
+		}
+
+		bool operator==( std::nullptr_t ) const noexcept
+		{
+			return get() == nullptr;
+		}
+
+		bool operator==( const SlotHandle& rhs ) const noexcept = default;
+
+		explicit operator bool() const noexcept
+		{
+			return get() != nullptr;
+		}
+
+		// ( index, generation )을 하나로 합친 값으로, 제거된 이후에도 변하지 않으므로 비교, 해시에서 사용합니다. ( null 핸들은 0입니다. )
+		std::uint64_t GetKey() const noexcept
+		{
+			if ( m_index == InvalidIndex )
+				return 0;
+
+			return ( static_cast< std::uint64_t >( m_generation ) << 32 ) | m_index;
+		}
+	};
+
+	template < typename T, typename Tag >
+	class SlotMap
+	{
+	public:
+		using ElementType = T;
+		using Handle      = SlotHandle< T, Tag >;
+
+	private:
+		// 사용 중일 때는 m_values의 인덱스를, 비어있을 때는 다음 빈 slot의 인덱스를 가집니다.
+		struct Slot
+		{
+			std::uint32_t denseIndexOrNextFree;
+			std::uint32_t generation;
+		};
+
+		static constexpr std::uint32_t InvalidIndex = Handle::InvalidIndex;
+
+		std::vector< Slot >          m_slots;
+		std::vector< ElementType >   m_values;       // 빈틈 없이 저장되는 ElementType들
+		std::vector< std::uint32_t > m_denseToSlot;  // m_values[ i ]를 가리키는 slot의 인덱스
+		std::uint32_t                m_freeHead = InvalidIndex;
+
+	public:
+		SlotMap() = default;
+
+		SlotMap( const SlotMap& )            = delete;
+		SlotMap& operator=( const SlotMap& ) = delete;
+
+		// 핸들이 가리키는, T와 Tag별로 하나씩 존재하는 SlotMap입니다.
+		static SlotMap& GetInstance() noexcept
+		{
+			static SlotMap s_instance;
+			return s_instance;
+		}
+
+		// ElementType을 생성하고, 이를 가리키는 핸들을 반환합니다.
+		template< typename... Args >
+			requires std::is_constructible_v< ElementType, Args&&... >
+		[[nodiscard]] Handle Emplace( Args&&... args )
+		{
+			const std::uint32_t denseIndex = static_cast< std::uint32_t >( m_values.size() );
+			m_values.emplace_back( std::forward< Args >( args )... );
+
+			std::uint32_t slotIndex = m_freeHead;
+			try
+			{
+				if ( slotIndex != InvalidIndex )
+				{
+					m_denseToSlot.push_back( slotIndex );
+					m_freeHead = m_slots[ slotIndex ].denseIndexOrNextFree;
+				}
+				else
+				{
+					slotIndex = static_cast< std::uint32_t >( m_slots.size() );
+					assert( slotIndex != InvalidIndex && "SlotMap is full" );
+
+					m_denseToSlot.push_back( slotIndex );
+					m_slots.push_back( Slot{ InvalidIndex, 1 } );
+				}
+			}
+			catch ( ... )
+			{
+				m_denseToSlot.resize( denseIndex );
+				m_values.pop_back();
+				throw;
+			}
+
+			m_slots[ slotIndex ].denseIndexOrNextFree = denseIndex;
+			return Handle( slotIndex, m_slots[ slotIndex ].generation );
+		}
+
+		// handle이 가리키는 ElementType을 제거합니다. 같은 slot을 가리키던 모든 핸들은 null이 됩니다.
+		bool Erase( const Handle handle ) noexcept
+		{
+			if ( !Contains( handle ) )
+				return false;
+
+			Slot&               slot       = m_slots[ handle.m_index ];
+			const std::uint32_t denseIndex = slot.denseIndexOrNextFree;
+			const std::uint32_t lastIndex  = static_cast< std::uint32_t >( m_values.size() - 1 );
+
+			// 마지막 ElementType을 빈 자리로 옮겨, 빈틈 없이 유지합니다.
+			if ( denseIndex != lastIndex )
+			{
+				m_values[ denseIndex ]      = std::move( m_values[ lastIndex ] );
+				m_denseToSlot[ denseIndex ] = m_denseToSlot[ lastIndex ];
+				m_slots[ m_denseToSlot[ denseIndex ] ].denseIndexOrNextFree = denseIndex;
+			}
+
+			m_values.pop_back();
+			m_denseToSlot.pop_back();
+
+			// generation이 한 바퀴 돌면, 이전 핸들과 겹치지 않도록 이 slot은 더 이상 재사용하지 않습니다.
+			if ( ++slot.generation != 0 ) [[likely]]
+			{
+				slot.denseIndexOrNextFree = m_freeHead;
+				m_freeHead                = handle.m_index;
+			}
+
+			return true;
+		}
+
+		[[nodiscard]] bool Contains( const Handle handle ) const noexcept
+		{
+			return handle.m_index < m_slots.size() && m_slots[ handle.m_index ].generation == handle.m_generation;
+		}
+
+		// handle이 유효하다면 ElementType*를, 아니라면 nullptr을 반환합니다.
+		[[nodiscard]] ElementType* Find( const Handle handle ) const noexcept
+		{
+			if ( !Contains( handle ) )
+				return nullptr;
+
+			return const_cast< ElementType* >( &m_values[ m_slots[ handle.m_index ].denseIndexOrNextFree ] );
+		}
+
+		// 선형 순회를 위한 ElementType들입니다. ( 순서는 생성, 제거에 따라 바뀝니다. )
+		[[nodiscard]] std::span< ElementType > GetValues() noexcept
+		{
+			return m_values;
+		}
+
+		[[nodiscard]] std::span< const ElementType > GetValues() const noexcept
+		{
+			return m_values;
+		}
+
+		// GetValues()[ denseIndex ]를 가리키는 핸들을 반환합니다.
+		[[nodiscard]] Handle GetHandle( const std::size_t denseIndex ) const noexcept
+		{
+			assert( denseIndex < m_values.size() && "out of range" );
+
+			const std::uint32_t slotIndex = m_denseToSlot[ denseIndex ];
+			return Handle( slotIndex, m_slots[ slotIndex ].generation );
+		}
+
+		[[nodiscard]] std::size_t size() const noexcept
+		{
+			return m_values.size();
+		}
+
+		[[nodiscard]] bool empty() const noexcept
+		{
+			return m_values.empty();
+		}
+
+		void Reserve( const std::size_t count )
+		{
+			m_slots.reserve( count );
+			m_values.reserve( count );
+			m_denseToSlot.reserve( count );
+		}
+
+		// 모든 ElementType을 제거합니다. 기존 핸들은 모두 null이 됩니다.
+		void Clear() noexcept
+		{
+			while ( !m_values.empty() )
+				Erase( GetHandle( m_values.size() - 1 ) );
+		}
+	};
+
+	template < typename T, typename Tag >
+	class PointerTraits< SlotHandle< T, Tag > >
+		: public PointerTraitsBase< SlotHandle< T, Tag >, T >
+	{
+	public:
+		// 제거된( generation이 다른 ) 핸들은 null로 처리합니다.
+		static bool IsNull( const SlotHandle< T, Tag >& handle ) noexcept
+		{
+			return handle.get() == nullptr;
+		}
+
+		static T& Deref( const SlotHandle< T, Tag >& handle ) noexcept
+		{
+			return *handle.get();
+		}
+
+		template< typename... Args >
+			requires std::is_constructible_v< T, Args&&... >
+		static SlotHandle< T, Tag > Make( Args&&... args )
+		{
+			return SlotMap< T, Tag >::GetInstance().Emplace( std::forward< Args >( args )... );
+		}
+
+		static void Release( SlotHandle< T, Tag >& handle ) noexcept
+		{
+			SlotMap< T, Tag >::GetInstance().Erase( handle );
+		}
+
+		// ElementType의 주소는 생성, 제거 시 바뀌므로, 핸들의 값으로 비교합니다.
+		static std::uint64_t Identity( const SlotHandle< T, Tag >& handle ) noexcept
+		{
+			return handle.GetKey();
+		}
+	};
+}
+
+template< typename T, typename Tag = void >
+using WsySlotMap = WonSY::SlotMap< T, Tag >;
+
+template< typename T, typename Tag = void >
+using WsySlotHandle = WonSY::SlotHandle< T, Tag >;
+
+template< typename T, typename Tag = void >
+using WsyNotNullSlot = WonSY::NotNull< WsySlotHandle< T, Tag > >;
+
+template< typename T, typename Tag = void >
+using WsyNullableSlot = WonSY::Nullable< WsySlotHandle< T, Tag > >;
+
+#endif
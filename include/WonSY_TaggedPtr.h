@@ -0,0 +1,194 @@
+/*
+	Copyright 2023, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+
+#ifndef WONSY_TAGGED_PTR
+#define WONSY_TAGGED_PTR
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "WonSY_TypeUtil.h"
+
+
+namespace WonSY
+{
+	/*
+		NotNull< TaggedPtr< T > >, Nullable< TaggedPtr< T > >로 사용하는, 정렬로 인해 비어있는 포인터의 하위 비트에 Tag를 담는 RawPointer입니다.
+
+		테이블에 포인터와 함께 flag( dirty, pending-delete 등 )를 따로 두면 패딩으로 인해 16바이트가 되지만,
+		alignof( T )만큼 비어있는 하위 비트에 담으면 포인터 크기( 8바이트 )를 유지합니다.
+
+			- 0번 비트는 소유권( Owner ) 비트로 사용합니다. Own( ptr ), MakeNullable, EmplaceNullable로 생성된 경우에만 Owner이며,
+			  Nullable::Release()는 Owner일 때만 delete하므로, 빌려온( Borrowed ) 포인터에서 호출해도 안전합니다.
+			- 나머지 비트( UserTagCount개 )는 사용자 Tag로, TagType( 보통 비트 인덱스를 값으로 가지는 enum )으로 접근합니다.
+			- null 확인과 역참조는 Tag를 제외한 포인터로만 처리합니다.
+
+		주의 해야할 것은,
+			- 사용할 수 있는 Tag의 수는 alignof( T )에 따라 결정됩니다. ( 더 필요한 경우 alignas로 T의 정렬을 늘려주세요. )
+			- 소유권 비트도 함께 복사되므로, 복사본들 중 한 곳에서만 Release 해야 합니다.
+			- NotNull에는 Release가 없으므로, NotNull< TaggedPtr< T > >은 MakeNotNull, EmplaceNotNull로 생성할 수 없습니다. ( 빌려온 포인터나, Nullable에서 확장하여 사용합니다. )
+
+		[ Version ]
+		// 0.1
+			- 포인터와 flag를 8바이트에 담기 위해, 하위 비트에 소유권과 사용자 Tag를 담는 TaggedPtr을 추가하였습니다.
+	*/
+
+	template < typename T, typename _TagType >
+	class TaggedPtr
+	{
+	public:
+		using element_type = T;
+		using TagType      = _TagType;
+
+		static constexpr std::size_t    TagBitCount  = std::countr_zero( alignof( T ) );
+		static constexpr std::size_t    UserTagCount = TagBitCount ? TagBitCount - 1 : 0;
+		static constexpr std::uintptr_t TagMask      = ( std::uintptr_t{ 1 } << TagBitCount ) - 1;
+		static constexpr std::uintptr_t OwnerBit     = 1;
+
+		static_assert( TagBitCount >= 1, "TaggedPtr requires alignof( T ) >= 2 for the owner bit." );
+
+	private:
+		std::uintptr_t m_bits;
+
+		TaggedPtr( T* const ptr, const std::uintptr_t tags ) noexcept
+			: m_bits{ reinterpret_cast< std::uintptr_t >( ptr ) | tags }
+		{
+			assert( ( reinterpret_cast< std::uintptr_t >( ptr ) & TagMask ) == 0 && "misaligned pointer" );
+		}
+
+		static constexpr std::uintptr_t _GetUserTagBit( const TagType tag ) noexcept
+		{
+			const std::size_t index = static_cast< std::size_t >( tag );
+			assert( index < UserTagCount && "tag index out of range" );
+
+			return std::uintptr_t{ 1 } << ( index + 1 );
+		}
+
+	public:
+		TaggedPtr() noexcept
+			: m_bits{ 0 }
+		{
+		}
+
+		TaggedPtr( std::nullptr_t ) noexcept
+			: m_bits{ 0 }
+		{
+		}
+
+		// 빌려온( Borrowed ) 포인터로 생성합니다. Release()를 호출해도 delete되지 않습니다.
+		explicit TaggedPtr( T* const ptr ) noexcept
+			: TaggedPtr( ptr, 0 )
+		{
+		}
+
+		// new로 생성된 ptr의 소유권을 가지는 TaggedPtr을 생성합니다.
+		[[nodiscard]] static TaggedPtr Own( T* const ptr ) noexcept
+		{
+			return TaggedPtr( ptr, ptr ? OwnerBit : 0 );
+		}
+
+		TaggedPtr& operator=( std::nullptr_t ) noexcept
+		{
+			m_bits = 0;
+			return *this;
+		}
+
+		T* get() const noexcept
+		{
+			return reinterpret_cast< T* >( m_bits & ~TagMask );
+		}
+
+		T& operator*() const noexcept
+		{
+			return *get();
+		}
+
+		T* operator->() const noexcept
+		{
+			return get();
+		}
+
+		bool IsOwner() const noexcept
+		{
+			return ( m_bits & OwnerBit ) != 0;
+		}
+
+		bool HasTag( const TagType tag ) const noexcept
+		{
+			return ( m_bits & _GetUserTagBit( tag ) ) != 0;
+		}
+
+		void SetTag( const TagType tag, const bool isOn = true ) noexcept
+		{
+			if ( isOn )
+				m_bits |= _GetUserTagBit( tag );
+			else
+				m_bits &= ~_GetUserTagBit( tag );
+		}
+
+		// Owner일 경우 delete하고, null이 됩니다. ( Tag도 초기화됩니다. )
+		void Release() noexcept
+		{
+			if ( IsOwner() )
+				delete get();
+
+			m_bits = 0;
+		}
+
+		bool operator==( std::nullptr_t ) const noexcept
+		{
+			return get() == nullptr;
+		}
+
+		// 같은 개체를 가리키는지 비교합니다. ( Tag는 비교하지 않습니다. )
+		bool operator==( const TaggedPtr& rhs ) const noexcept
+		{
+			return get() == rhs.get();
+		}
+
+		explicit operator bool() const noexcept
+		{
+			return get() != nullptr;
+		}
+	};
+
+	template < typename T, typename TagType >
+	class PointerTraits< TaggedPtr< T, TagType > >
+		: public PointerTraitsBase< TaggedPtr< T, TagType >, T >
+	{
+	public:
+		static bool IsNull( const TaggedPtr< T, TagType >& ptr ) noexcept
+		{
+			return ptr.get() == nullptr;
+		}
+
+		static T& Deref( const TaggedPtr< T, TagType >& ptr ) noexcept
+		{
+			return *ptr.get();
+		}
+
+		// MakeNullable, EmplaceNullable로 생성된 경우, Owner가 됩니다. ( NotNull은 Release할 수 없으므로, MakeNotNull에서는 제한됩니다. )
+		template< typename... Args >
+			requires std::is_constructible_v< T, Args&&... >
+		static TaggedPtr< T, TagType > Make( Args&&... args )
+		{
+			return TaggedPtr< T, TagType >::Own( new T( std::forward< Args >( args )... ) );
+		}
+
+		static void Release( TaggedPtr< T, TagType >& ptr ) noexcept
+		{
+			ptr.Release();
+		}
+	};
+}
+
+#endif
@@ -11,8 +11,12 @@
 #define WONSY_TYPEUTIL
 
 
+#include <concepts>
+#include <cstdint>
 #include <memory>
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 namespace WonSY
 {
@@ -63,30 +67,289 @@ namespace WonSY
 	{
 	public:
 		using ElementType = InvalidType;
+		using DeleterType = InvalidType;
 	};
 	
-	template < typename T >
+	template < typename T, typename Deleter >
 	//class IsUniquePtr< T, std::void_t< std::is_same< T, std::unique_ptr< typename std::remove_cvref< typename T::element_type >::type > > > >
-	class IsUniquePtr< std::unique_ptr< T > >
+	class IsUniquePtr< std::unique_ptr< T, Deleter > >
 		: public std::true_type 
 	{
 	public:
-		using ElementType = std::unique_ptr< T >::element_type;
+		using ElementType = std::unique_ptr< T, Deleter >::element_type;
+		using DeleterType = Deleter;
 	};
 	
 	template < class T >
 	concept UniquePtrType = IsUniquePtr< T >::value;
+
+	template < typename T, typename = std::void_t<> >
+	class IsWeakPtr
+		: public std::false_type
+	{
+	public:
+		using ElementType = InvalidType;
+	};
+
+	template < typename T >
+	class IsWeakPtr< std::weak_ptr< T > >
+		: public std::true_type
+	{
+	public:
+		using ElementType = std::weak_ptr< T >::element_type;
+	};
+
+	template < class T >
+	concept WeakPtrType = IsWeakPtr< T >::value;
 	
+	// WonSY_Inline.h
+	template < typename T >
+	class Inline;
+
+	template < typename T, typename = std::void_t<> >
+	class IsInline
+		: public std::false_type
+	{
+	public:
+		using ElementType = InvalidType;
+	};
+
+	template < typename T >
+	class IsInline< Inline< T > >
+		: public std::true_type
+	{
+	public:
+		using ElementType = T;
+	};
+
+	template < class T >
+	concept InlineType = IsInline< T >::value;
+
+	// WonSY_IntrusivePtr.h
+	template < typename T >
+	class IntrusivePtr;
+
+	template < typename T, typename = std::void_t<> >
+	class IsIntrusivePtr
+		: public std::false_type
+	{
+	public:
+		using ElementType = InvalidType;
+	};
+
+	template < typename T >
+	class IsIntrusivePtr< IntrusivePtr< T > >
+		: public std::true_type
+	{
+	public:
+		using ElementType = T;
+	};
+
+	template < class T >
+	concept IntrusivePtrType = IsIntrusivePtr< T >::value;
+
+	// WonSY_LocalSharedPtr.h
+	template < typename T >
+	class LocalSharedPtr;
+
+	template < typename T, typename = std::void_t<> >
+	class IsLocalSharedPtr
+		: public std::false_type
+	{
+	public:
+		using ElementType = InvalidType;
+	};
+
+	template < typename T >
+	class IsLocalSharedPtr< LocalSharedPtr< T > >
+		: public std::true_type
+	{
+	public:
+		using ElementType = T;
+	};
+
+	template < class T >
+	concept LocalSharedPtrType = IsLocalSharedPtr< T >::value;
+
+	// WonSY_TaggedPtr.h
+	template < typename T, typename TagType = std::size_t >
+	class TaggedPtr;
+
+	template < typename T, typename = std::void_t<> >
+	class IsTaggedPtr
+		: public std::false_type
+	{
+	public:
+		using ElementType = InvalidType;
+	};
+
+	template < typename T, typename TagType >
+	class IsTaggedPtr< TaggedPtr< T, TagType > >
+		: public std::true_type
+	{
+	public:
+		using ElementType = T;
+	};
+
+	template < class T >
+	concept TaggedPtrType = IsTaggedPtr< T >::value;
+
+	/*
+		NotNull, Nullable이 사용할 수 있는 포인터 타입을 정의하는 Customization Point입니다.
+
+		사용자 타입( 사내 핸들, Pool 핸들, Allocator의 fancy pointer 등 )도 PointerTraits를 특수화하면, 래퍼 없이 NotNull, Nullable로 사용할 수 있습니다.
+		PointerTraitsBase< T, ElementType >를 상속하면 기본 동작( == nullptr, operator* )을 사용하며, 필요한 함수만 다시 정의하면 됩니다.
+
+			- ElementType                            : ( 필수 ) 가리키는 타입입니다.
+			- static bool IsNull( const T& )         : ( 필수 ) null 여부를 반환합니다.
+			- static ElementType& Deref( const T& )  : ( 필수 ) 가리키는 데이터를 반환합니다.
+			- static T Make( Args&&... )             : ( 선택 ) MakeNotNull, EmplaceNotNull, MakeNullable, EmplaceNullable에서 사용합니다.
+			- static void Release( T& )              : ( 선택 ) Nullable::Release()에서, null을 할당하기 전에 호출됩니다.
+			- static long UseCount( const T& )       : ( 선택 ) NotNull::GetUseCount()에서 사용합니다.
+			- static uint64_t Identity( const T& )   : ( 선택 ) 비교, 해시에서 사용하며, 정의하지 않으면 가리키는 개체의 주소를 사용합니다. ( null은 0이어야 합니다. )
+			- static Guard Pin()                     : ( 선택 ) Nullable을 확장하는 매크로가, 확장한 스코프 동안 반환된 Guard를 유지합니다. ( 지연된 해제 등에서 사용합니다. )
+
+		또한 Type은 nullptr로 생성, 할당될 수 있어야 합니다.
+	*/
+	template < typename T >
+	class PointerTraits
+		: public std::false_type
+	{
+	public:
+		using ElementType = InvalidType;
+	};
+
+	template < typename T, typename _ElementType >
+	class PointerTraitsBase
+		: public std::true_type
+	{
+	public:
+		using ElementType = _ElementType;
+
+		static bool IsNull( const T& ptr ) noexcept
+		{
+			return ptr == nullptr;
+		}
+
+		static ElementType& Deref( const T& ptr ) noexcept
+		{
+			return *ptr;
+		}
+	};
+
+	template < typename T >
+	class PointerTraits< T* >
+		: public PointerTraitsBase< T*, typename IsRawPtr< T* >::ElementType >
+	{
+	};
+
+	template < typename T >
+	class PointerTraits< std::shared_ptr< T > >
+		: public PointerTraitsBase< std::shared_ptr< T >, typename IsSharedPtr< std::shared_ptr< T > >::ElementType >
+	{
+	};
+
+	template < typename T, typename Deleter >
+	class PointerTraits< std::unique_ptr< T, Deleter > >
+		: public PointerTraitsBase< std::unique_ptr< T, Deleter >, typename IsUniquePtr< std::unique_ptr< T, Deleter > >::ElementType >
+	{
+	};
+
+	// weak_ptr은 lock() 없이 역참조할 수 없으므로, Deref를 정의하지 않습니다. ( NotNull< weak_ptr >은 허용하지 않습니다. )
+	// null 확인은 lock() 없이 expired()로 처리하며, Nullable은 확장 시 한번만 lock()하여 NotNull< shared_ptr >로 확장합니다.
+	template < typename T >
+	class PointerTraits< std::weak_ptr< T > >
+		: public std::true_type
+	{
+	public:
+		using ElementType = typename IsWeakPtr< std::weak_ptr< T > >::ElementType;
+
+		static bool IsNull( const std::weak_ptr< T >& ptr ) noexcept
+		{
+			return ptr.expired();
+		}
+	};
+
+	template < typename T >
+	class PointerTraits< Inline< T > >
+		: public PointerTraitsBase< Inline< T >, T >
+	{
+	};
+
+	template < typename T >
+	class PointerTraits< IntrusivePtr< T > >
+		: public PointerTraitsBase< IntrusivePtr< T >, T >
+	{
+	};
+
+	template < typename T >
+	class PointerTraits< LocalSharedPtr< T > >
+		: public PointerTraitsBase< LocalSharedPtr< T >, T >
+	{
+	};
+
+	template < class T >
+	concept PointerTraitsType = PointerTraits< T >::value && requires( const T& ptr )
+	{
+		typename PointerTraits< T >::ElementType;
+		{ PointerTraits< T >::IsNull( ptr ) } -> std::convertible_to< bool >;
+		{ PointerTraits< T >::Deref( ptr ) }  -> std::same_as< typename PointerTraits< T >::ElementType& >;
+	};
+
+	template < class T, class... Args >
+	concept PointerTraitsMakeable = requires( Args&&... args )
+	{
+		{ PointerTraits< T >::Make( std::forward< Args >( args )... ) } -> std::convertible_to< T >;
+	};
+
+	template < class T >
+	concept PointerTraitsReleasable = requires( T& ptr )
+	{
+		PointerTraits< T >::Release( ptr );
+	};
+
+	template < class T >
+	concept PointerTraitsUseCountable = requires( const T& ptr )
+	{
+		{ PointerTraits< T >::UseCount( ptr ) } -> std::convertible_to< long >;
+	};
+
+	template < class T >
+	concept PointerTraitsIdentifiable = requires( const T& ptr )
+	{
+		{ PointerTraits< T >::Identity( ptr ) } -> std::convertible_to< std::uint64_t >;
+	};
+
+	template < class T >
+	concept PointerTraitsPinnable = requires
+	{
+		PointerTraits< T >::Pin();
+	};
+
+	// NotNull, Nullable의 비교, 해시에서 사용하는 Identity입니다. ( ElementType의 값이 아닌, 가리키는 개체로 비교합니다. )
+	// null은 0이며, PointerTraits< T >::Identity가 정의되어 있지 않다면 가리키는 개체의 주소를 사용합니다.
+	template < PointerTraitsType T >
+	[[nodiscard]] std::uint64_t GetIdentity( const T& ptr ) noexcept
+	{
+		if constexpr ( PointerTraitsIdentifiable< T > )
+		{
+			return static_cast< std::uint64_t >( PointerTraits< T >::Identity( ptr ) );
+		}
+		else
+		{
+			if ( PointerTraits< T >::IsNull( ptr ) )
+				return 0;
+
+			return static_cast< std::uint64_t >( reinterpret_cast< std::uintptr_t >( std::addressof( PointerTraits< T >::Deref( ptr ) ) ) );
+		}
+	}
+
+	// IsRawPtr, IsSharedPtr, IsUniquePtr 등을 직접 분기하지 않고 PointerTraits로 처리하여, 사용자 타입도 지원합니다.
 	template < class T >
 	class ElementType
 	{
 	public:
-		using Type = typename std::conditional<
-			IsRawPtr< T >::value, 
-				typename IsRawPtr< T >::ElementType,
-				typename std::conditional< IsSharedPtr< T >::value,
-					typename IsSharedPtr< T >::ElementType,
-					typename IsUniquePtr< T >::ElementType >::type >::type;
+		using Type = typename PointerTraits< T >::ElementType;
 	};
 }
 
@@ -102,4 +365,19 @@ using WsySharedPtr = std::shared_ptr< T >;
 template< class T >
 using WsyUniquePtr = std::unique_ptr< T >;
 
+template< class T >
+using WsyWeakPtr = std::weak_ptr< T >;
+
+template< class T >
+using WsyInline = WonSY::Inline< T >;
+
+template< class T >
+using WsyIntrusivePtr = WonSY::IntrusivePtr< T >;
+
+template< class T >
+using WsyLocalSharedPtr = WonSY::LocalSharedPtr< T >;
+
+template< class T, class TagType = std::size_t >
+using WsyTaggedPtr = WonSY::TaggedPtr< T, TagType >;
+
 #endif